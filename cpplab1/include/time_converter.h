@@ -3,8 +3,56 @@
 #ifndef TIME_CONVERTER_H
 #define TIME_CONVERTER_H
 
+#include <array>
+#include <cstddef>
+#include <span>
 #include <string>
+#include <string_view>
 
-std::string convertTo24Hour(int hour, int minute, const std::string& period);
+// Размер результата пакетного преобразования: ровно 4 символа "HHMM" без '\0'
+inline constexpr std::size_t kTimeResultSize = 4;
 
-#endif // TIME_CONVERTER_H
\ No newline at end of file
+// Входная запись для пакетного преобразования (час, минута, "am"/"pm")
+struct TimeRecord {
+    int hour;
+    int minute;
+    std::string_view period;
+};
+
+// Преобразование в строку "HHMM". Для допустимых входов (1..12, 0..59, "am"/"pm")
+// результат берётся из таблицы, построенной на этапе компиляции.
+std::string convertTo24Hour(int hour, int minute, std::string_view period);
+
+// Коды ошибок проверяющего преобразования
+enum class TimeError {
+    None,
+    InvalidHour,    // Час вне 1..12
+    InvalidMinute,  // Минута вне 0..59
+    InvalidPeriod,  // Период не "am" и не "pm"
+};
+
+// Результат проверяющего преобразования (аналог std::expected<"HHMM", TimeError>)
+struct TimeResult {
+    std::array<char, kTimeResultSize> value{};  // Заполнено только при error == TimeError::None
+    TimeError error = TimeError::None;
+
+    explicit operator bool() const noexcept { return error == TimeError::None; }
+    std::string_view view() const noexcept { return std::string_view(value.data(), value.size()); }
+};
+
+// Проверяющее преобразование без исключений и выделений памяти.
+// Ошибки проверяются в порядке: час, минута, период.
+TimeResult tryConvertTo24Hour(int hour, int minute, std::string_view period) noexcept;
+
+// Преобразование одной записи в caller-owned буфер out (4 символа, без выделений памяти).
+// Час (после перевода в 24-часовой формат) и минута записываются двумя младшими десятичными
+// цифрами, поэтому результат совпадает со строковой версией, только если оба значения в 0..99
+// (например, час 0..12 и минута 0..99). Вне этой области нужна строковая версия.
+void convertTo24Hour(int hour, int minute, std::string_view period, char* out) noexcept;
+
+// Пакетное преобразование: результаты пишутся подряд по 4 символа на запись
+// (с той же областью значений, что и у преобразования в буфер).
+// out должен вмещать records.size() * kTimeResultSize символов.
+void convertTo24Hour(std::span<const TimeRecord> records, std::span<char> out);
+
+#endif // TIME_CONVERTER_H
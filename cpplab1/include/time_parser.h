@@ -0,0 +1,27 @@
+#pragma once
+
+#ifndef TIME_PARSER_H
+#define TIME_PARSER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Итоги пакетного разбора
+struct TimeParseStats {
+    std::size_t records = 0;  // Успешно преобразованных записей
+    std::size_t errors = 0;   // Записей, у которых час или минута не являются целым числом
+};
+
+// Разбор текста из записей "hh mm period", разделённых любыми пробельными символами
+// (как при чтении std::cin >> hour >> minute >> period). Для каждой записи в out
+// дописывается результат convertTo24Hour и '\n'. Поиск границ токенов выполняется
+// блоками по 32 (AVX2) или 16 (SSE2) байт, на остальных платформах - побайтово.
+TimeParseStats convertTimeRecords(std::string_view text, std::string& out);
+
+// Преобразование строки из одной записи "hh mm period" (потоковый режим): результат
+// дописывается в out так же, как convertTimeRecords. Если в строке не ровно одна запись
+// или час и минута не целые числа - false, out не меняется.
+bool convertTimeLine(std::string_view line, std::string& out);
+
+#endif // TIME_PARSER_H
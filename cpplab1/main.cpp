@@ -1,9 +1,167 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <string>
+#include <string_view>
+#include <vector>
 #include "include/time_converter.h"
+#include "include/time_parser.h"
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr std::size_t kStreamBufferSize = 1 << 16;
+
+// Потоковый режим: построчное преобразование stdin -> stdout с буферизованным вводом-выводом.
+// Строка преобразуется так же, как запись в --bulk; пустые строки пропускаются
+int runStream() {
+    std::vector<char> input(kStreamBufferSize);
+    std::string output;
+    output.reserve(kStreamBufferSize);
+    std::size_t pending = 0;  // Незавершённая строка в начале input
+    std::size_t lineNumber = 0;
+    bool eof = false;
+
+    auto flush = [&]() {
+        std::fwrite(output.data(), 1, output.size(), stdout);
+        output.clear();
+    };
+
+    auto processLine = [&](std::string_view line) {
+        ++lineNumber;
+        if (line.find_first_not_of(" \t\r") == std::string_view::npos) return;
+
+        if (!convertTimeLine(line, output)) {
+            std::fprintf(stderr, "Line %zu: invalid record\n", lineNumber);
+            return;
+        }
+        if (output.size() >= kStreamBufferSize) flush();
+    };
+
+    while (!eof) {
+        if (pending == input.size()) input.resize(input.size() * 2);  // Очень длинная строка
+        std::size_t read = std::fread(input.data() + pending, 1, input.size() - pending, stdin);
+        eof = read == 0;
+        std::size_t end = pending + read;
+
+        std::size_t begin = 0;
+        while (const void* nl = std::memchr(input.data() + begin, '\n', end - begin)) {
+            std::size_t pos = static_cast<const char*>(nl) - input.data();
+            processLine(std::string_view(input.data() + begin, pos - begin));
+            begin = pos + 1;
+        }
+
+        pending = end - begin;
+        std::memmove(input.data(), input.data() + begin, pending);
+    }
+    if (pending > 0) processLine(std::string_view(input.data(), pending));
+
+    flush();
+    return 0;
+}
+
+// Файл, отображённый в память только для чтения (без mmap - прочитанный целиком)
+class MappedFile {
+public:
+    explicit MappedFile(const char* path) {
+#if !defined(_WIN32)
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return;
+        struct stat st;
+        if (::fstat(fd, &st) == 0) {
+            if (st.st_size == 0) {
+                ok = true;  // mmap не отображает пустые файлы
+            } else {
+                void* data = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data != MAP_FAILED) {
+                    ::madvise(data, st.st_size, MADV_SEQUENTIAL);
+                    mapped = static_cast<const char*>(data);
+                    length = st.st_size;
+                    ok = true;
+                }
+            }
+        }
+        ::close(fd);
+#else
+        std::ifstream file(path, std::ios::binary);
+        buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        ok = static_cast<bool>(file) || file.eof();
+#endif
+    }
+
+    ~MappedFile() {
+#if !defined(_WIN32)
+        if (mapped) ::munmap(const_cast<char*>(mapped), length);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isOpen() const { return ok; }
+
+    std::string_view text() const {
+#if !defined(_WIN32)
+        return std::string_view(mapped, length);
+#else
+        return std::string_view(buffer.data(), buffer.size());
+#endif
+    }
+
+private:
+    bool ok = false;
+#if !defined(_WIN32)
+    const char* mapped = nullptr;
+    std::size_t length = 0;
+#else
+    std::vector<char> buffer;
+#endif
+};
+
+// Пакетный режим: разбор отображённого в память файла и отчёт о скорости в stderr
+int runBulk(const char* path) {
+    MappedFile file(path);
+    if (!file.isOpen()) {
+        std::fprintf(stderr, "Cannot open %s\n", path);
+        return 1;
+    }
+
+    std::string output;
+    auto start = std::chrono::steady_clock::now();
+    TimeParseStats stats = convertTimeRecords(file.text(), output);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::fwrite(output.data(), 1, output.size(), stdout);
+
+    double seconds = elapsed.count();
+    std::fprintf(stderr, "%zu records, %zu errors, %.3f s, %.0f records/s\n", stats.records,
+                 stats.errors, seconds, seconds > 0 ? stats.records / seconds : 0.0);
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc > 1 && std::string_view(argv[1]) == "--stream") {
+        return runStream();
+    }
+    if (argc > 1 && std::string_view(argv[1]) == "--bulk") {
+        if (argc < 3) {
+            std::fprintf(stderr, "Usage: %s --bulk <file>\n", argv[0]);
+            return 1;
+        }
+        return runBulk(argv[2]);
+    }
 
-int main() {
     int hour, minute;
     std::string period;
 
@@ -13,4 +171,4 @@ int main() {
     std::cout << result << std::endl;
 
     return 0;
-}
\ No newline at end of file
+}
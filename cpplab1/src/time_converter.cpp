@@ -1,8 +1,60 @@
 #include "../include/time_converter.h"
+#include <array>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
+#include <stdexcept>
 
-std::string convertTo24Hour(int hour, int minute, const std::string& period) {
+namespace {
+
+constexpr int kHours = 12;
+constexpr int kMinutes = 60;
+
+using PackedTime = std::array<char, kTimeResultSize>;
+
+// Таблица всех 12 * 60 * 2 допустимых входов: индекс ((hour - 1) * 60 + minute) * 2 + pm
+constexpr std::array<PackedTime, kHours * kMinutes * 2> makeTimeTable() {
+    std::array<PackedTime, kHours * kMinutes * 2> table{};
+    for (int hour = 1; hour <= kHours; ++hour) {
+        for (int minute = 0; minute < kMinutes; ++minute) {
+            for (int pm = 0; pm < 2; ++pm) {
+                int h24 = hour % 12 + (pm ? 12 : 0);
+                PackedTime& entry = table[((hour - 1) * kMinutes + minute) * 2 + pm];
+                entry[0] = static_cast<char>('0' + h24 / 10);
+                entry[1] = static_cast<char>('0' + h24 % 10);
+                entry[2] = static_cast<char>('0' + minute / 10);
+                entry[3] = static_cast<char>('0' + minute % 10);
+            }
+        }
+    }
+    return table;
+}
+
+constexpr auto kTimeTable = makeTimeTable();
+
+static_assert(kTimeTable[(11 * kMinutes + 0) * 2 + 0] == PackedTime{'0', '0', '0', '0'});
+static_assert(kTimeTable[(11 * kMinutes + 0) * 2 + 1] == PackedTime{'1', '2', '0', '0'});
+static_assert(kTimeTable[(10 * kMinutes + 59) * 2 + 1] == PackedTime{'2', '3', '5', '9'});
+
+// 0 - "am", 1 - "pm", -1 - любой другой период
+inline int periodIndex(std::string_view period) noexcept {
+    if (period.size() != 2 || period[1] != 'm') return -1;
+    if (period[0] == 'a') return 0;
+    if (period[0] == 'p') return 1;
+    return -1;
+}
+
+// Указатель на запись таблицы или nullptr, если вход вне табличной области
+inline const PackedTime* lookup(int hour, int minute, std::string_view period) noexcept {
+    int pm = periodIndex(period);
+    if (pm < 0 || static_cast<unsigned>(hour - 1) >= kHours ||
+        static_cast<unsigned>(minute) >= kMinutes) {
+        return nullptr;
+    }
+    return &kTimeTable[((hour - 1) * kMinutes + minute) * 2 + pm];
+}
+
+inline int adjustHour(int hour, std::string_view period) noexcept {
     if (period == "am") {
         if (hour == 12) {
             hour = 0;
@@ -12,8 +64,61 @@ std::string convertTo24Hour(int hour, int minute, const std::string& period) {
             hour += 12;
         }
     }
+    return hour;
+}
+
+// Запись двух младших десятичных цифр значения без обращения к iostream
+inline void writeTwoDigits(char* out, int value) noexcept {
+    unsigned v = static_cast<unsigned>(value) % 100;
+    out[0] = static_cast<char>('0' + v / 10);
+    out[1] = static_cast<char>('0' + v % 10);
+}
+
+} // namespace
+
+std::string convertTo24Hour(int hour, int minute, std::string_view period) {
+    if (const PackedTime* entry = lookup(hour, minute, period)) {
+        return std::string(entry->data(), entry->size());
+    }
 
+    // Вне табличной области сохраняем прежнее форматирование (setw допускает более 2 цифр)
     std::ostringstream oss;
-    oss << std::setfill('0') << std::setw(2) << hour << std::setw(2) << minute;
+    oss << std::setfill('0') << std::setw(2) << adjustHour(hour, period) << std::setw(2) << minute;
     return oss.str();
-}
\ No newline at end of file
+}
+
+TimeResult tryConvertTo24Hour(int hour, int minute, std::string_view period) noexcept {
+    TimeResult result;
+    if (const PackedTime* entry = lookup(hour, minute, period)) {
+        result.value = *entry;
+    } else if (static_cast<unsigned>(hour - 1) >= kHours) {
+        result.error = TimeError::InvalidHour;
+    } else if (static_cast<unsigned>(minute) >= kMinutes) {
+        result.error = TimeError::InvalidMinute;
+    } else {
+        result.error = TimeError::InvalidPeriod;
+    }
+    return result;
+}
+
+void convertTo24Hour(int hour, int minute, std::string_view period, char* out) noexcept {
+    if (const PackedTime* entry = lookup(hour, minute, period)) {
+        std::memcpy(out, entry->data(), kTimeResultSize);
+        return;
+    }
+
+    writeTwoDigits(out, adjustHour(hour, period));
+    writeTwoDigits(out + 2, minute);
+}
+
+void convertTo24Hour(std::span<const TimeRecord> records, std::span<char> out) {
+    if (out.size() < records.size() * kTimeResultSize) {
+        throw std::invalid_argument("Output buffer is too small");
+    }
+
+    char* dst = out.data();
+    for (const TimeRecord& record : records) {
+        convertTo24Hour(record.hour, record.minute, record.period, dst);
+        dst += kTimeResultSize;
+    }
+}
@@ -0,0 +1,130 @@
+#include "../include/time_parser.h"
+#include "../include/time_converter.h"
+#include <bit>
+#include <charconv>
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Пробельные символы в смысле std::isspace: ' ', '\t', '\n', '\v', '\f', '\r'
+inline bool isSpace(char c) noexcept {
+    return c == ' ' || static_cast<unsigned char>(c - '\t') <= '\r' - '\t';
+}
+
+// Маска пробельных символов в блоке: бит i установлен, если p[i] - пробельный символ
+#if defined(__AVX2__)
+constexpr std::size_t kBlockSize = 32;
+
+inline std::uint32_t spaceMask(const char* p) noexcept {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i x = _mm256_sub_epi8(v, _mm256_set1_epi8('\t'));
+    __m256i ctrl = _mm256_cmpeq_epi8(_mm256_min_epu8(x, _mm256_set1_epi8('\r' - '\t')), x);
+    __m256i space = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(ctrl, space)));
+}
+#elif defined(__SSE2__) || defined(_M_X64)
+constexpr std::size_t kBlockSize = 16;
+
+inline std::uint32_t spaceMask(const char* p) noexcept {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i x = _mm_sub_epi8(v, _mm_set1_epi8('\t'));
+    __m128i ctrl = _mm_cmpeq_epi8(_mm_min_epu8(x, _mm_set1_epi8('\r' - '\t')), x);
+    __m128i space = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(ctrl, space)));
+}
+#else
+constexpr std::size_t kBlockSize = 0;
+
+inline std::uint32_t spaceMask(const char*) noexcept {
+    return 0;
+}
+#endif
+
+// Первая позиция в [p, end), где isSpace(c) == wantSpace
+template <bool wantSpace>
+const char* findFirst(const char* p, const char* end) noexcept {
+    if constexpr (kBlockSize > 0) {
+        constexpr std::uint32_t full = kBlockSize == 32 ? ~0u : (1u << (kBlockSize % 32)) - 1;
+        while (static_cast<std::size_t>(end - p) >= kBlockSize) {
+            std::uint32_t mask = spaceMask(p);
+            if (!wantSpace) mask = ~mask & full;
+            if (mask != 0) return p + std::countr_zero(mask);
+            p += kBlockSize;
+        }
+    }
+    while (p < end && isSpace(*p) != wantSpace) ++p;
+    return p;
+}
+
+// Следующий токен, начиная с p; пустой токен означает конец текста
+inline std::string_view nextToken(const char*& p, const char* end) noexcept {
+    const char* begin = findFirst<false>(p, end);
+    p = findFirst<true>(begin, end);
+    return std::string_view(begin, p - begin);
+}
+
+inline bool parseInt(std::string_view token, int& value) noexcept {
+    auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+    return ec == std::errc() && ptr == token.data() + token.size();
+}
+
+// Результат convertTo24Hour и '\n' в конец out
+void appendTime(int hour, int minute, std::string_view period, std::string& out) {
+    if (hour >= 0 && hour <= 12 && minute >= 0 && minute <= 99) {
+        char result[kTimeResultSize];
+        convertTo24Hour(hour, minute, period, result);
+        out.append(result, kTimeResultSize);
+    } else {
+        // Результат может быть длиннее 4 символов - используем общий путь
+        out += convertTo24Hour(hour, minute, period);
+    }
+    out += '\n';
+}
+
+} // namespace
+
+TimeParseStats convertTimeRecords(std::string_view text, std::string& out) {
+    TimeParseStats stats;
+    const char* p = text.data();
+    const char* end = p + text.size();
+
+    // Запись занимает не меньше 6 байт ("1 0 a\n"), результат - 5 байт
+    out.reserve(out.size() + text.size());
+
+    while (true) {
+        std::string_view hourToken = nextToken(p, end);
+        if (hourToken.empty()) break;
+        std::string_view minuteToken = nextToken(p, end);
+        std::string_view period = nextToken(p, end);
+
+        int hour, minute;
+        if (period.empty() || !parseInt(hourToken, hour) || !parseInt(minuteToken, minute)) {
+            ++stats.errors;
+            continue;
+        }
+
+        appendTime(hour, minute, period, out);
+        ++stats.records;
+    }
+    return stats;
+}
+
+bool convertTimeLine(std::string_view line, std::string& out) {
+    const char* p = line.data();
+    const char* end = p + line.size();
+    std::string_view hourToken = nextToken(p, end);
+    std::string_view minuteToken = nextToken(p, end);
+    std::string_view period = nextToken(p, end);
+
+    int hour, minute;
+    if (period.empty() || !parseInt(hourToken, hour) || !parseInt(minuteToken, minute) ||
+        !nextToken(p, end).empty()) {
+        return false;
+    }
+    appendTime(hour, minute, period, out);
+    return true;
+}
@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include "../include/time_converter.h"
+
+// Исходная реализация на ostringstream - точка отсчёта для сравнения
+static std::string legacyConvertTo24Hour(int hour, int minute, const std::string& period) {
+    if (period == "am") {
+        if (hour == 12) {
+            hour = 0;
+        }
+    } else if (period == "pm") {
+        if (hour != 12) {
+            hour += 12;
+        }
+    }
+
+    std::ostringstream oss;
+    oss << std::setfill('0') << std::setw(2) << hour << std::setw(2) << minute;
+    return oss.str();
+}
+
+static std::vector<TimeRecord> makeRecords() {
+    std::vector<TimeRecord> records;
+    for (int hour = 1; hour <= 12; ++hour) {
+        for (int minute = 0; minute < 60; ++minute) {
+            records.push_back({hour, minute, "am"});
+            records.push_back({hour, minute, "pm"});
+        }
+    }
+    return records;
+}
+
+static void BM_Legacy(benchmark::State& state) {
+    const auto records = makeRecords();
+    const std::string am = "am", pm = "pm";
+    for (auto _ : state) {
+        for (const TimeRecord& r : records) {
+            benchmark::DoNotOptimize(legacyConvertTo24Hour(r.hour, r.minute, r.period == "am" ? am : pm));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+BENCHMARK(BM_Legacy);
+
+static void BM_Lookup(benchmark::State& state) {
+    const auto records = makeRecords();
+    for (auto _ : state) {
+        for (const TimeRecord& r : records) {
+            benchmark::DoNotOptimize(convertTo24Hour(r.hour, r.minute, r.period));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+BENCHMARK(BM_Lookup);
+
+static void BM_LookupBatch(benchmark::State& state) {
+    const auto records = makeRecords();
+    std::vector<char> out(records.size() * kTimeResultSize);
+    for (auto _ : state) {
+        convertTo24Hour(records, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+BENCHMARK(BM_LookupBatch);
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 #include "../include/time_converter.h"
+#include "../include/time_parser.h"
+#include <cstdio>
+#include <limits>
+#include <vector>
 
 TEST(ConvertTo24Hour, Midnight) {
     EXPECT_EQ(convertTo24Hour(12, 0, "am"), "0000");
@@ -41,6 +45,163 @@ TEST(ConvertTo24Hour, SixPm) {
     EXPECT_EQ(convertTo24Hour(6, 0, "pm"), "1800");
 }
 
+TEST(ConvertTo24Hour, StringViewAndStringPeriod) {
+    std::string period = "pm";
+    std::string_view view = period;
+    EXPECT_EQ(convertTo24Hour(3, 7, period), "1507");
+    EXPECT_EQ(convertTo24Hour(3, 7, view), "1507");
+}
+
+TEST(ConvertTo24Hour, OutsideTableKeepsLegacyFormatting) {
+    EXPECT_EQ(convertTo24Hour(7, 30, "xx"), "0730");
+    EXPECT_EQ(convertTo24Hour(0, 5, "am"), "0005");
+    EXPECT_EQ(convertTo24Hour(99, 120, "pm"), "111120");
+}
+
+TEST(ConvertTo24HourBatch, SingleRecordBuffer) {
+    char out[kTimeResultSize];
+    convertTo24Hour(12, 5, "am", out);
+    EXPECT_EQ(std::string(out, kTimeResultSize), "0005");
+}
+
+TEST(ConvertTo24HourBatch, MatchesStringVersion) {
+    const TimeRecord records[] = {
+        {12, 0, "am"}, {12, 0, "pm"}, {1, 15, "pm"}, {11, 59, "pm"}, {6, 0, "am"}, {7, 30, "xx"},
+    };
+    std::string out(std::size(records) * kTimeResultSize, ' ');
+    convertTo24Hour(records, out);
+
+    for (std::size_t i = 0; i < std::size(records); ++i) {
+        const TimeRecord& r = records[i];
+        EXPECT_EQ(out.substr(i * kTimeResultSize, kTimeResultSize),
+                  convertTo24Hour(r.hour, r.minute, std::string(r.period)));
+    }
+}
+
+TEST(ConvertTo24HourBatch, BufferTooSmall) {
+    const TimeRecord records[] = {{1, 0, "am"}, {2, 0, "am"}};
+    char out[kTimeResultSize];
+    EXPECT_THROW(convertTo24Hour(records, out), std::invalid_argument);
+}
+
+TEST(ConvertTimeRecords, MixedWhitespace) {
+    std::string out;
+    TimeParseStats stats = convertTimeRecords("12 00 am\n1 15\tpm\r\n  11 59 pm   6 0 xx\n", out);
+    EXPECT_EQ(stats.records, 4u);
+    EXPECT_EQ(stats.errors, 0u);
+    EXPECT_EQ(out, "0000\n1315\n2359\n0600\n");
+}
+
+TEST(ConvertTimeRecords, InvalidRecordsAreCounted) {
+    std::string out;
+    TimeParseStats stats = convertTimeRecords("ab 10 am 3 4 pm 5", out);
+    EXPECT_EQ(stats.records, 1u);
+    EXPECT_EQ(stats.errors, 2u);
+    EXPECT_EQ(out, "1504\n");
+}
+
+TEST(ConvertTimeRecords, MatchesConvertTo24HourAcrossBlocks) {
+    // Длинные разделители и токены пересекают границы блоков по 16/32 байта
+    std::string text, expected;
+    for (int hour = -1; hour <= 14; ++hour) {
+        for (int minute = 0; minute < 120; minute += 7) {
+            for (const char* period : {"am", "pm", "xx"}) {
+                text += std::to_string(hour) + std::string(hour + 2, ' ') + std::to_string(minute) +
+                        "\t" + period + std::string(minute % 40 + 1, '\n');
+                expected += convertTo24Hour(hour, minute, period) + "\n";
+            }
+        }
+    }
+
+    std::string out;
+    TimeParseStats stats = convertTimeRecords(text, out);
+    EXPECT_EQ(stats.errors, 0u);
+    EXPECT_EQ(out, expected);
+}
+
+TEST(ConvertTimeLine, MatchesStringVersionOutsideTable) {
+    // Поля вне таблицы и отрицательные: результат длиннее 4 символов или со знаком
+    std::string out, expected;
+    for (int hour : {-100, -1, 0, 1, 12, 13, 99, 100, 123456}) {
+        for (int minute : {-5, 0, 59, 99, 100, 120}) {
+            for (const char* period : {"am", "pm", "xx"}) {
+                std::string line = std::to_string(hour) + " " + std::to_string(minute) + "\t" + period;
+                EXPECT_TRUE(convertTimeLine(line, out)) << line;
+                expected += convertTo24Hour(hour, minute, period) + "\n";
+            }
+        }
+    }
+    EXPECT_EQ(out, expected);
+
+    out.clear();
+    EXPECT_TRUE(convertTimeLine("99 120 pm", out));
+    EXPECT_TRUE(convertTimeLine("-1 5 am\r", out));
+    EXPECT_EQ(out, "111120\n-105\n");
+}
+
+TEST(ConvertTimeLine, InvalidLineLeavesOutputUnchanged) {
+    std::string out = "0000\n";
+    EXPECT_FALSE(convertTimeLine("ab 10 am", out));
+    EXPECT_FALSE(convertTimeLine("3 4", out));
+    EXPECT_FALSE(convertTimeLine("3 4 pm 5", out));
+    EXPECT_FALSE(convertTimeLine("", out));
+    EXPECT_EQ(out, "0000\n");
+}
+
+TEST(TryConvertTo24Hour, ValidInput) {
+    TimeResult result = tryConvertTo24Hour(12, 30, "am");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.view(), "0030");
+}
+
+TEST(TryConvertTo24Hour, ReportsFirstInvalidField) {
+    EXPECT_EQ(tryConvertTo24Hour(99, 0, "am").error, TimeError::InvalidHour);
+    EXPECT_EQ(tryConvertTo24Hour(0, 0, "pm").error, TimeError::InvalidHour);
+    EXPECT_EQ(tryConvertTo24Hour(13, 75, "xx").error, TimeError::InvalidHour);
+    EXPECT_EQ(tryConvertTo24Hour(5, 60, "xx").error, TimeError::InvalidMinute);
+    EXPECT_EQ(tryConvertTo24Hour(5, -1, "am").error, TimeError::InvalidMinute);
+    EXPECT_EQ(tryConvertTo24Hour(5, 0, "xx").error, TimeError::InvalidPeriod);
+    EXPECT_EQ(tryConvertTo24Hour(5, 0, "PM").error, TimeError::InvalidPeriod);
+    EXPECT_FALSE(tryConvertTo24Hour(5, 0, ""));
+}
+
+TEST(TryConvertTo24Hour, ExhaustiveDomain) {
+    // Вся допустимая область и её окрестность, включая крайние значения int
+    std::vector<int> hours = {std::numeric_limits<int>::min(), std::numeric_limits<int>::max()};
+    for (int hour = -2; hour <= 14; ++hour) hours.push_back(hour);
+    std::vector<int> minutes = {std::numeric_limits<int>::min(), std::numeric_limits<int>::max()};
+    for (int minute = -2; minute <= 61; ++minute) minutes.push_back(minute);
+    const char* periods[] = {"am", "pm", "AM", "pM", "xx", "a", "amx", ""};
+
+    std::size_t valid = 0;
+    for (int hour : hours) {
+        for (int minute : minutes) {
+            for (std::string_view period : periods) {
+                TimeResult result = tryConvertTo24Hour(hour, minute, period);
+
+                TimeError expected = TimeError::None;
+                if (hour < 1 || hour > 12) {
+                    expected = TimeError::InvalidHour;
+                } else if (minute < 0 || minute > 59) {
+                    expected = TimeError::InvalidMinute;
+                } else if (period != "am" && period != "pm") {
+                    expected = TimeError::InvalidPeriod;
+                }
+                ASSERT_EQ(result.error, expected) << hour << " " << minute << " " << period;
+
+                if (result) {
+                    ++valid;
+                    int h24 = hour % 12 + (period == "pm" ? 12 : 0);
+                    char expectedText[8];
+                    std::snprintf(expectedText, sizeof(expectedText), "%02d%02d", h24, minute);
+                    ASSERT_EQ(result.view(), expectedText);
+                }
+            }
+        }
+    }
+    EXPECT_EQ(valid, 12u * 60u * 2u);
+}
+
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -1,49 +1,281 @@
 #ifndef HEX_H
 #define HEX_H
 
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <initializer_list>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class Hex;
+
+// Слагаемое ленивого выражения: значение и знак, с которым оно входит в сумму
+struct HexTerm {
+    const Hex* value;
+    bool negative;
+};
+
+template <class L, class R, bool Minus>
+class HexSumExpr;
 
 class Hex {
 private:
-    unsigned char* digits;  // Динамический массив цифр (0-15)
-    size_t size;            // Количество цифр (размер числа)
-    
+    static constexpr size_t kDigitsPerLimb = 16; // Шестнадцатеричных цифр в одном 64-битном слове
+    static constexpr size_t kInlineLimbs = 2;    // Числа до 32 цифр хранятся без кучи
+
+    uint64_t* limbs;        // Слова модуля числа (inlineLimbs или куча), младшее слово первым
+    size_t size;            // Количество цифр модуля (размер числа)
+    size_t capacity;        // Ёмкость limbs в словах
+    uint64_t inlineLimbs[kInlineLimbs]; // Встроенный буфер для коротких чисел
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource(); // Источник памяти limbs
+    bool negative = false;  // Знак (у нуля всегда false)
+
     // Вспомогательные методы
-    void normalize();       // Удаление ведущих нулей
+    void allocate(size_t count); // Хранилище минимум на count слов (содержимое не сохраняется)
+    void reserve(size_t count);  // Рост ёмкости с запасом, используемые слова сохраняются
+    void release() noexcept;     // Освобождение памяти кучи, если она использовалась
+    bool isInline() const noexcept;
+    void normalize();       // Удаление ведущих нулей (без перевыделения памяти)
     unsigned char charToDigit(char c) const; // Преобразование char в цифру (0-15)
-    char digitToChar(unsigned char d) const; // Преобразование цифры в char ('0'-'F')
-    
+    void parse(std::string_view str);        // Значение из строки (вызывается для числа 0)
+    size_t limbCount() const noexcept;       // Количество используемых слов
+    unsigned char digitAt(size_t i) const noexcept; // i-я цифра (0 - младшая)
+    bool isZero() const noexcept;
+    int compare(const Hex& other) const noexcept;          // -1, 0 или 1 с учётом знака
+    int compareMagnitude(const Hex& other) const noexcept; // Сравнение модулей
+    // this = (|a| - |b|), со сменой знака при flip; заём из старшего слова означает |a| < |b|,
+    // тогда разность дополняется до модуля. this может совпадать с a или b
+    void assignDifference(const Hex& a, const Hex& b, bool flip);
+    void addInPlace(const Hex& other, bool otherNegative);      // this += (±other)
+    Hex addSigned(const Hex& other, bool otherNegative) const;  // this + (±other)
+    Hex powmodMontgomery(const Hex& exponent, const Hex& modulus) const; // Нечётный модуль
+    void assignSum(const HexTerm* terms, size_t count); // this = сумма слагаемых за один проход
+    static Hex sumRange(const Hex* first, const Hex* last); // Последовательная сумма диапазона
+    // Побитовая операция op над словами модулей; при keepTail хвост длинного операнда копируется
+    template <class Op>
+    Hex combineWords(const Hex& other, Op op, bool keepTail) const;
+
 public:
-    // Конструкторы и деструктор
+    // Длина операндов в 64-битных словах, начиная с которой умножение идёт по Карацубе (не меньше 4)
+    static size_t karatsubaThreshold;
+
+    // Конструкторы и деструктор.
+    // Число хранится как знак и модуль; строка может начинаться с '-'.
+    // Память под длинные числа берётся из memory_resource (по умолчанию - get_default_resource()).
+    // Результаты операций используют ресурс левого операнда, копия - ресурс по умолчанию
     Hex();
+    // Число 0 в заданном ресурсе. Тип ресурса - параметр шаблона, чтобы литерал 0 в Hex(0)
+    // не преобразовывался в указатель
+    template <class Resource>
+        requires(std::is_base_of_v<std::pmr::memory_resource, Resource>)
+    explicit Hex(Resource* resource) noexcept;
     Hex(const size_t& n, unsigned char t = 0);
     Hex(const std::initializer_list<unsigned char>& list);
-    Hex(const std::string& str);
+    // Число из строки (std::string, std::string_view, литерал, const char*); числа сюда
+    // не подходят, поэтому Hex(0) - конструктор размера
+    template <class String>
+        requires(std::is_convertible_v<const String&, std::string_view>)
+    Hex(const String& str, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    // Число из 64-битных слов, младшее слово первым (пустой набор - 0)
+    static Hex fromWords(std::span<const uint64_t> words,
+                         std::pmr::memory_resource* resource = std::pmr::get_default_resource());
     Hex(const Hex& other);           // Конструктор копирования
-    Hex(Hex&& other) noexcept;      // Конструктор перемещения
+    Hex(const Hex& other, std::pmr::memory_resource* resource); // Копия в заданном ресурсе
+    Hex(Hex&& other) noexcept;      // Конструктор перемещения (ресурс переходит вместе с памятью)
     ~Hex() noexcept;                // Деструктор
 
+    // Вычисление ленивого выражения a + b - c ... (результат может быть отрицательным)
+    template <class L, class R, bool Minus>
+    Hex(const HexSumExpr<L, R, Minus>& expr);
+
+    // Присваивание (имеющаяся ёмкость переиспользуется, ресурс приёмника не меняется;
+    // перемещение между разными ресурсами копирует слова)
+    Hex& operator=(const Hex& other);
+    Hex& operator=(Hex&& other);
+    // Выражение вычисляется прямо в буфер приёмника
+    template <class L, class R, bool Minus>
+    Hex& operator=(const HexSumExpr<L, R, Minus>& expr);
+
     // Методы доступа
-    size_t getSize() const noexcept;
-    std::string toString() const;    // Представление в виде строки
+    size_t getSize() const noexcept;      // Количество цифр модуля
+    bool isNegative() const noexcept;
+    std::pmr::memory_resource* getResource() const noexcept;
+    std::string toString() const;    // Представление в виде строки ('-' перед модулем, если число отрицательное)
+    // Запись представления в буфер out (getSize() + isNegative() символов, для пустого объекта - "0")
+    // без '\0';
+    // возвращает указатель за последним записанным символом
+    char* toChars(char* out) const;
+    // Используемые 64-битные слова модуля, младшее первым; действительны до изменения объекта
+    std::span<const uint64_t> words() const noexcept;
+
+    // Двоичный формат: 64-битный префикс с количеством цифр (старший бит - знак),
+    // затем слова числа; всё в little-endian. Запись кратна 8 байтам
+    size_t binarySize() const noexcept;
+    // Запись в буфер out (binarySize() байт); возвращает указатель за последним записанным байтом
+    unsigned char* toBinary(unsigned char* out) const;
 
     // Арифметические операции (с созданием нового объекта)
     Hex add(const Hex& other) const;     // Сложение
     Hex subtract(const Hex& other) const; // Вычитание (если результат отрицательный - исключение)
+    Hex subtractSigned(const Hex& other) const; // Вычитание без исключений (результат со знаком)
+    Hex multiply(const Hex& other) const; // Умножение
+    // Частное (с отбрасыванием дробной части) и остаток со знаком делимого (деление на 0 - исключение)
+    std::pair<Hex, Hex> divmod(const Hex& divisor) const;
+    Hex mod(const Hex& modulus) const;                     // Остаток от деления
+    // this^exponent mod modulus в диапазоне [0, modulus); показатель не меньше 0, модуль больше 0
+    Hex powmod(const Hex& exponent, const Hex& modulus) const;
     Hex copy() const;                    // Копирование
+    Hex operator-() const;               // Число с противоположным знаком
+    Hex& negate() noexcept;              // Смена знака на месте (0 остаётся 0)
+    // Сумма всех значений (пустой набор - 0). Большие наборы делятся между потоками,
+    // результат совпадает с последовательным сложением
+    static Hex sum(std::span<const Hex> values);
+    // Сумма, разделённая ровно на threads частей (не больше числа значений; 0 или 1 - без потоков)
+    static Hex sum(std::span<const Hex> values, size_t threads);
+
+    // Битовые операции над модулем (без преобразования в строку).
+    // Сдвиги сохраняют знак: сдвиг вправо отбрасывает младшие биты модуля
+    Hex shiftLeft(size_t bits) const;          // Умножение модуля на 2^bits
+    Hex shiftRight(size_t bits) const;         // Деление модуля на 2^bits
+    Hex shiftLeftDigits(size_t digits) const;  // Приписывание digits нулевых цифр
+    Hex shiftRightDigits(size_t digits) const; // Отбрасывание digits младших цифр
+    // Побитовые И, ИЛИ, исключающее ИЛИ модулей; результат неотрицательный
+    Hex bitAnd(const Hex& other) const;
+    Hex bitOr(const Hex& other) const;
+    Hex bitXor(const Hex& other) const;
+    size_t popcount() const noexcept;          // Количество единичных битов модуля
+    Hex operator<<(size_t bits) const;
+    Hex operator>>(size_t bits) const;
+    Hex operator&(const Hex& other) const;
+    Hex operator|(const Hex& other) const;
+    Hex operator^(const Hex& other) const;
 
     // Операции сравнения
     bool equals(const Hex& other) const noexcept; // Равно
     bool greaterThan(const Hex& other) const;     // Больше
     bool lessThan(const Hex& other) const;        // Меньше
+    bool operator==(const Hex& other) const noexcept;
+    std::strong_ordering operator<=>(const Hex& other) const noexcept;
+
+    // Хеш по упакованным словам (для std::unordered_map и подобных контейнеров)
+    size_t hash() const noexcept;
 
     // Операции с присваиванием (возвращают новый объект)
     Hex addAssign(const Hex& other) const;        // +=
     Hex subtractAssign(const Hex& other) const;   // -=
 
-    // Вспомогательные методы для тестирования
-    const unsigned char* getDigits() const noexcept;
+    // Операции с присваиванием на месте: память выделяется, только если результат не помещается
+    Hex& operator+=(const Hex& other);
+    Hex& operator-=(const Hex& other);            // Результат может быть отрицательным
+
+    // Вспомогательные методы для тестирования.
+    // Цифры модуля, распакованные из слов по одной на байт (младшая первой)
+    std::vector<unsigned char> getDigits() const;
 };
 
+template <>
+struct std::hash<Hex> {
+    size_t operator()(const Hex& value) const noexcept {
+        return value.hash();
+    }
+};
+
+// Ленивые выражения: operator+ и operator- не вычисляют результат, а запоминают операнды.
+// Вся цепочка вычисляется за один проход по словам при построении или присваивании Hex;
+// знак слагаемого - знак в выражении, умноженный на знак значения.
+// Выражение хранит ссылки на операнды, поэтому его не следует сохранять в auto.
+template <class T>
+inline constexpr bool isHexOperand = false;
+
+template <>
+inline constexpr bool isHexOperand<Hex> = true;
+
+template <class L, class R, bool Minus>
+inline constexpr bool isHexOperand<HexSumExpr<L, R, Minus>> = true;
+
+template <class T>
+inline constexpr size_t hexTermCount = 1;
+
+template <class L, class R, bool Minus>
+inline constexpr size_t hexTermCount<HexSumExpr<L, R, Minus>> = hexTermCount<L> + hexTermCount<R>;
+
+inline void collectHexTerms(const Hex& value, HexTerm* out, bool negative) {
+    *out = {&value, negative};
+}
+
+template <class L, class R, bool Minus>
+void collectHexTerms(const HexSumExpr<L, R, Minus>& expr, HexTerm* out, bool negative) {
+    expr.collect(out, negative);
+}
+
+template <class L, class R, bool Minus>
+class HexSumExpr {
+public:
+    static constexpr size_t termCount = hexTermCount<L> + hexTermCount<R>;
+
+    HexSumExpr(const L& left, const R& right) : left(left), right(right) {}
+
+    // Раскладка выражения в плоский список слагаемых со знаками
+    void collect(HexTerm* out, bool negative) const {
+        collectHexTerms(left, out, negative);
+        collectHexTerms(right, out + hexTermCount<L>, negative != Minus);
+    }
+
+private:
+    // Hex хранится по ссылке, вложенные выражения - по значению (они состоят из ссылок)
+    using Stored = std::conditional_t<std::is_same_v<L, Hex>, const Hex&, L>;
+    using StoredRight = std::conditional_t<std::is_same_v<R, Hex>, const Hex&, R>;
+
+    Stored left;
+    StoredRight right;
+};
+
+template <class L, class R>
+    requires(isHexOperand<L> && isHexOperand<R>)
+HexSumExpr<L, R, false> operator+(const L& left, const R& right) {
+    return HexSumExpr<L, R, false>(left, right);
+}
+
+template <class L, class R>
+    requires(isHexOperand<L> && isHexOperand<R>)
+HexSumExpr<L, R, true> operator-(const L& left, const R& right) {
+    return HexSumExpr<L, R, true>(left, right);
+}
+
+template <class Resource>
+    requires(std::is_base_of_v<std::pmr::memory_resource, Resource>)
+Hex::Hex(Resource* resource) noexcept
+    : limbs(inlineLimbs), size(1), capacity(kInlineLimbs), resource(resource) {
+    limbs[0] = 0;
+}
+
+template <class String>
+    requires(std::is_convertible_v<const String&, std::string_view>)
+Hex::Hex(const String& str, std::pmr::memory_resource* resource) : Hex(resource) {
+    parse(std::string_view(str));
+}
+
+template <class L, class R, bool Minus>
+Hex::Hex(const HexSumExpr<L, R, Minus>& expr) : Hex() {
+    std::array<HexTerm, HexSumExpr<L, R, Minus>::termCount> terms;
+    expr.collect(terms.data(), false);
+    resource = terms[0].value->resource; // Ресурс левого операнда
+    assignSum(terms.data(), terms.size());
+}
+
+template <class L, class R, bool Minus>
+Hex& Hex::operator=(const HexSumExpr<L, R, Minus>& expr) {
+    std::array<HexTerm, HexSumExpr<L, R, Minus>::termCount> terms;
+    expr.collect(terms.data(), false);
+    assignSum(terms.data(), terms.size());
+    return *this;
+}
+
 #endif // HEX_H
@@ -0,0 +1,79 @@
+#ifndef HEX_FILE_H
+#define HEX_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <string>
+#include <vector>
+#include "Hex.h"
+
+// Число в двоичном формате Hex::toBinary без копирования: слова читаются прямо из буфера
+class HexView {
+public:
+    HexView() noexcept = default;
+    HexView(const uint64_t* words, size_t digits, bool negative = false) noexcept;
+
+    size_t getSize() const noexcept { return digits; }  // Количество цифр модуля
+    bool isNegative() const noexcept { return negative; }
+    std::span<const uint64_t> words() const noexcept;   // Слова модуля, младшее первым
+    Hex toHex() const;                                  // Копия в виде Hex
+    std::string toString() const;
+
+private:
+    const uint64_t* limbs = nullptr;
+    size_t digits = 0;
+    bool negative = false;
+};
+
+// Запись чисел в файл подряд в двоичном формате; ошибка ввода-вывода - исключение
+void writeHexFile(const std::string& path, std::span<const Hex> values);
+
+// Файл чисел, отображённый в память только для чтения (без mmap - прочитанный целиком).
+// Записи проверяются при открытии; обход выдаёт HexView без выделения памяти на число
+class HexFileReader {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = HexView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = HexView;
+
+        Iterator() noexcept = default;
+        explicit Iterator(const uint64_t* position) noexcept : position(position) {}
+
+        HexView operator*() const noexcept;
+        Iterator& operator++() noexcept;
+        Iterator operator++(int) noexcept;
+        bool operator==(const Iterator& other) const noexcept = default;
+
+    private:
+        const uint64_t* position = nullptr; // Префикс текущей записи
+    };
+
+    explicit HexFileReader(const std::string& path); // Файл не открыт или повреждён - исключение
+    ~HexFileReader() noexcept;
+
+    HexFileReader(const HexFileReader&) = delete;
+    HexFileReader& operator=(const HexFileReader&) = delete;
+
+    size_t size() const noexcept { return count; } // Количество записей
+    Iterator begin() const noexcept { return Iterator(data); }
+    Iterator end() const noexcept { return Iterator(data + length); }
+
+private:
+    const uint64_t* data = nullptr; // Начало файла (выровнено на 8 байт)
+    size_t length = 0;              // Длина в словах
+    size_t count = 0;
+#if !defined(_WIN32)
+    void* mapped = nullptr;
+    size_t mappedBytes = 0;
+#else
+    std::vector<uint64_t> buffer;
+#endif
+};
+
+#endif // HEX_FILE_H
@@ -0,0 +1,58 @@
+#ifndef HEX_LIMBS_H
+#define HEX_LIMBS_H
+
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+// Операции над 64-битными словами, общие для Hex и HexN.
+// Во время компиляции используется переносимый вариант, во время выполнения - инструкции adc/sbb
+namespace hexlimbs {
+
+// Сложение слов с переносом: возвращает a + b + carry, новый перенос записывается в carry
+constexpr uint64_t addCarry(uint64_t a, uint64_t b, unsigned char& carry) noexcept {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (!std::is_constant_evaluated()) {
+        unsigned long long out;
+        carry = _addcarry_u64(carry, a, b, &out);
+        return out;
+    }
+#endif
+    uint64_t sum = a + carry;
+    unsigned char c = sum < carry;
+    sum += b;
+    carry = c | (sum < b);
+    return sum;
+}
+
+// Вычитание слов с заёмом: возвращает a - b - borrow, новый заём записывается в borrow
+constexpr uint64_t subBorrow(uint64_t a, uint64_t b, unsigned char& borrow) noexcept {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (!std::is_constant_evaluated()) {
+        unsigned long long out;
+        borrow = _subborrow_u64(borrow, a, b, &out);
+        return out;
+    }
+#endif
+    uint64_t diff = a - b;
+    unsigned char c = a < b;
+    c |= diff < borrow;
+    diff -= borrow;
+    borrow = c;
+    return diff;
+}
+
+// Значение шестнадцатеричной цифры или -1 для недопустимого символа
+constexpr int digitValue(char c) noexcept {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+} // namespace hexlimbs
+
+#endif // HEX_LIMBS_H
@@ -0,0 +1,163 @@
+#ifndef HEX_N_H
+#define HEX_N_H
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "Hex.h"
+#include "HexLimbs.h"
+
+// Беззнаковое число фиксированной ширины Bits (кратной 64) без динамической памяти.
+// Все операции (кроме преобразований в Hex и из Hex) constexpr; сложение и вычитание
+// выполняются по модулю 2^Bits, цепочки переносов развёрнуты на все слова
+template <size_t Bits>
+class HexN {
+    static_assert(Bits > 0 && Bits % 64 == 0, "HexN width must be a positive multiple of 64 bits");
+
+public:
+    static constexpr size_t kLimbs = Bits / 64;  // Количество 64-битных слов
+    static constexpr size_t kDigits = Bits / 4;  // Максимальное количество цифр
+
+    // Конструкторы
+    constexpr HexN() noexcept : limbs{} {}
+    constexpr explicit HexN(uint64_t value) noexcept : limbs{} {
+        limbs[0] = value;
+    }
+    // Разбор строки; недопустимая цифра или слишком длинное число - исключение
+    // (при вычислении во время компиляции - ошибка компиляции)
+    constexpr explicit HexN(std::string_view str) : limbs{} {
+        if (str.empty()) throw std::invalid_argument("Empty string");
+        size_t first = str.find_first_not_of('0');
+        if (first != std::string_view::npos && str.size() - first > kDigits) {
+            throw std::invalid_argument("Value does not fit into HexN");
+        }
+        for (size_t i = 0; i < str.size(); ++i) {
+            int digit = hexlimbs::digitValue(str[str.size() - 1 - i]);
+            if (digit < 0) throw std::invalid_argument("Invalid hexadecimal digit");
+            if (i < kDigits) limbs[i / 16] |= static_cast<uint64_t>(digit) << (i % 16 * 4);
+        }
+    }
+    constexpr explicit HexN(const char* str) : HexN(std::string_view(str)) {}
+    constexpr explicit HexN(const std::string& str) : HexN(std::string_view(str)) {}
+
+    // Преобразование из Hex; если число отрицательное или не помещается в Bits - исключение
+    explicit HexN(const Hex& value) : limbs{} {
+        if (value.isNegative()) throw std::invalid_argument("HexN cannot hold a negative value");
+        std::span<const uint64_t> words = value.words();
+        if (words.size() > kLimbs) throw std::invalid_argument("Value does not fit into HexN");
+        std::copy(words.begin(), words.end(), limbs.begin());
+    }
+
+    // Методы доступа
+    constexpr uint64_t limb(size_t i) const noexcept { return limbs[i]; } // i-е слово (0 - младшее)
+    Hex toHex() const { return Hex::fromWords(limbs); }
+
+    // Представление в виде строки (как у Hex: верхний регистр, без ведущих нулей)
+    constexpr std::string toString() const {
+        constexpr char kDigitChars[] = "0123456789ABCDEF";
+        std::string result;
+        for (size_t i = kDigits; i > 0; --i) {
+            unsigned digit = static_cast<unsigned>(limbs[(i - 1) / 16] >> ((i - 1) % 16 * 4)) & 0xF;
+            if (digit != 0 || !result.empty() || i == 1) result += kDigitChars[digit];
+        }
+        return result;
+    }
+    constexpr bool isZero() const noexcept {
+        return std::all_of(limbs.begin(), limbs.end(), [](uint64_t w) { return w == 0; });
+    }
+
+    // Арифметические операции (по модулю 2^Bits)
+    constexpr HexN add(const HexN& other) const noexcept {
+        return addLimbs(other, std::make_index_sequence<kLimbs>{});
+    }
+    constexpr HexN subtract(const HexN& other) const noexcept {
+        return subtractLimbs(other, std::make_index_sequence<kLimbs>{});
+    }
+
+    constexpr HexN operator+(const HexN& other) const noexcept { return add(other); }
+    constexpr HexN operator-(const HexN& other) const noexcept { return subtract(other); }
+    constexpr HexN& operator+=(const HexN& other) noexcept { return *this = add(other); }
+    constexpr HexN& operator-=(const HexN& other) noexcept { return *this = subtract(other); }
+
+    // Операции сравнения: по словам от старшего
+    constexpr bool operator==(const HexN& other) const noexcept = default;
+    constexpr std::strong_ordering operator<=>(const HexN& other) const noexcept {
+        for (size_t i = kLimbs; i > 0; --i) {
+            if (limbs[i - 1] != other.limbs[i - 1]) return limbs[i - 1] <=> other.limbs[i - 1];
+        }
+        return std::strong_ordering::equal;
+    }
+
+private:
+    std::array<uint64_t, kLimbs> limbs; // Младшее слово первым
+
+    // Цепочки переносов, развёрнутые свёрткой по индексам слов
+    template <size_t... I>
+    constexpr HexN addLimbs(const HexN& other, std::index_sequence<I...>) const noexcept {
+        HexN result;
+        unsigned char carry = 0;
+        ((result.limbs[I] = hexlimbs::addCarry(limbs[I], other.limbs[I], carry)), ...);
+        return result;
+    }
+    template <size_t... I>
+    constexpr HexN subtractLimbs(const HexN& other, std::index_sequence<I...>) const noexcept {
+        HexN result;
+        unsigned char borrow = 0;
+        ((result.limbs[I] = hexlimbs::subBorrow(limbs[I], other.limbs[I], borrow)), ...);
+        return result;
+    }
+};
+
+using Hex128 = HexN<128>;
+using Hex256 = HexN<256>;
+using Hex512 = HexN<512>;
+
+// Ширина, достаточная для digits цифр (не меньше одного слова)
+constexpr size_t hexBitsFor(size_t digits) noexcept {
+    return std::max<size_t>(1, (digits + 15) / 16) * 64;
+}
+
+// Строка - параметр шаблона для литерала "FFFF"_hex
+template <size_t N>
+struct HexLiteral {
+    char chars[N]{};
+
+    constexpr HexLiteral(const char (&str)[N]) noexcept {
+        std::copy(str, str + N, chars);
+    }
+    constexpr std::string_view view() const noexcept { return {chars, N - 1}; }
+};
+
+// Литерал "FFFF"_hex: разбирается во время компиляции, ширина определяется количеством цифр
+template <HexLiteral literal>
+constexpr auto operator""_hex() {
+    constexpr HexN<hexBitsFor(literal.view().size())> value(literal.view());
+    return value;
+}
+
+// Литерал 0xDEAD'BEEF_hex: то же для числовой записи (допускаются разделители ')
+template <char... Chars>
+constexpr auto operator""_hex() {
+    constexpr std::array<char, sizeof...(Chars)> chars{Chars...};
+    static_assert(chars.size() > 2 && chars[0] == '0' && (chars[1] == 'x' || chars[1] == 'X'),
+                  "_hex numeric literal must start with 0x");
+    constexpr size_t digits = chars.size() - 2 - std::count(chars.begin(), chars.end(), '\'');
+    constexpr auto text = [&] {
+        std::array<char, digits> result{};
+        size_t n = 0;
+        for (size_t i = 2; i < chars.size(); ++i) {
+            if (chars[i] != '\'') result[n++] = chars[i];
+        }
+        return result;
+    }();
+    constexpr HexN<hexBitsFor(digits)> value(std::string_view(text.data(), text.size()));
+    return value;
+}
+
+#endif // HEX_N_H
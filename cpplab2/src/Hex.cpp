@@ -1,83 +1,804 @@
 #include "../include/Hex.h"
+#include "../include/HexLimbs.h"
 #include <stdexcept>
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cctype>
+#include <cstring>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+using hexlimbs::addCarry;
+using hexlimbs::subBorrow;
+
+// Количество слов, необходимых для n цифр
+inline size_t limbsFor(size_t digits) noexcept {
+    return (digits + 15) / 16;
+}
+
+// Перестановка байтов слова (std::byteswap появляется только в C++23)
+inline uint64_t byteSwap(uint64_t value) noexcept {
+#if defined(_MSC_VER)
+    return _byteswap_uint64(value);
+#else
+    return __builtin_bswap64(value);
+#endif
+}
+
+// Таблица декодирования символа в цифру: 0xFF - недопустимый символ
+constexpr std::array<unsigned char, 256> makeDecodeTable() {
+    std::array<unsigned char, 256> table{};
+    for (auto& entry : table) entry = 0xFF;
+    for (int c = '0'; c <= '9'; ++c) table[c] = static_cast<unsigned char>(c - '0');
+    for (int c = 'A'; c <= 'F'; ++c) table[c] = static_cast<unsigned char>(c - 'A' + 10);
+    for (int c = 'a'; c <= 'f'; ++c) table[c] = static_cast<unsigned char>(c - 'a' + 10);
+    return table;
+}
+
+constexpr auto kDecodeTable = makeDecodeTable();
+constexpr char kEncodeTable[] = "0123456789ABCDEF";
+
+// Скалярное декодирование count (<= 16) символов, старшая цифра первой; false - недопустимый символ
+inline bool decodeScalar(const char* p, size_t count, uint64_t& out) noexcept {
+    uint64_t value = 0;
+    unsigned char bad = 0;
+    for (size_t i = 0; i < count; ++i) {
+        unsigned char d = kDecodeTable[static_cast<unsigned char>(p[i])];
+        bad |= d;
+        value = (value << 4) | (d & 0x0F);
+    }
+    out = value;
+    return (bad & 0xF0) == 0;
+}
+
+// Скалярное кодирование младших count (<= 16) цифр слова, старшая цифра первой
+inline void encodeScalar(uint64_t value, size_t count, char* out) noexcept {
+    for (size_t i = count; i > 0; --i) {
+        out[i - 1] = kEncodeTable[value & 0x0F];
+        value >>= 4;
+    }
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+// Цифры 16 символов (старшая первой) в байтах вектора; false - есть недопустимый символ
+inline bool decodeNibbles(__m128i v, __m128i& nibbles) noexcept {
+    __m128i digit = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    __m128i alpha = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    __m128i isAlpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+    nibbles = _mm_or_si128(_mm_and_si128(isDigit, digit),
+                           _mm_and_si128(isAlpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+    return _mm_movemask_epi8(_mm_or_si128(isDigit, isAlpha)) == 0xFFFF;
+}
+
+// Пары цифр -> байты (старший байт первым) -> 64-битное слово
+inline uint64_t packNibbles(__m128i nibbles) noexcept {
+    __m128i high = _mm_and_si128(_mm_slli_epi16(nibbles, 4), _mm_set1_epi16(0x00FF));
+    __m128i bytes = _mm_or_si128(high, _mm_srli_epi16(nibbles, 8));
+    uint64_t bigEndian = static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_packus_epi16(bytes, bytes)));
+    return byteSwap(bigEndian);
+}
+
+inline bool decode16(const char* p, uint64_t& out) noexcept {
+    __m128i nibbles;
+    if (!decodeNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), nibbles)) return false;
+    out = packNibbles(nibbles);
+    return true;
+}
+
+// Слово -> 16 ASCII-символов (старшая цифра первой)
+inline void encode16(uint64_t value, char* out) noexcept {
+    __m128i bytes = _mm_cvtsi64_si128(static_cast<long long>(byteSwap(value)));
+    __m128i mask = _mm_set1_epi8(0x0F);
+    __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+    __m128i low = _mm_and_si128(bytes, mask);
+    __m128i nibbles = _mm_unpacklo_epi8(high, low);
+    __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('A' - '0' - 10));
+    __m128i ascii = _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), ascii);
+}
+#else
+inline bool decode16(const char* p, uint64_t& out) noexcept {
+    return decodeScalar(p, 16, out);
+}
+
+inline void encode16(uint64_t value, char* out) noexcept {
+    encodeScalar(value, 16, out);
+}
+#endif
+
+#if defined(__AVX2__)
+// 32 символа -> два слова: hi - из первых 16 символов, lo - из последних
+inline bool decode32(const char* p, uint64_t& hi, uint64_t& lo) noexcept {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i digit = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+    __m256i alpha = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    __m256i isDigit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    __m256i isAlpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+    if (_mm256_movemask_epi8(_mm256_or_si256(isDigit, isAlpha)) != -1) return false;
+
+    __m256i nibbles = _mm256_or_si256(_mm256_and_si256(isDigit, digit),
+                                      _mm256_and_si256(isAlpha, _mm256_add_epi8(alpha, _mm256_set1_epi8(10))));
+    __m256i high = _mm256_and_si256(_mm256_slli_epi16(nibbles, 4), _mm256_set1_epi16(0x00FF));
+    __m256i bytes = _mm256_or_si256(high, _mm256_srli_epi16(nibbles, 8));
+    __m256i packed = _mm256_packus_epi16(bytes, bytes); // Упаковка внутри каждой 128-битной половины
+    hi = byteSwap(static_cast<uint64_t>(_mm256_extract_epi64(packed, 0)));
+    lo = byteSwap(static_cast<uint64_t>(_mm256_extract_epi64(packed, 2)));
+    return true;
+}
+#endif
+
+// a * b + c + d: младшее слово возвращается, старшее записывается в hi (переполнения нет)
+inline uint64_t mulAdd(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t& hi) noexcept {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 t = static_cast<unsigned __int128>(a) * b + c + d;
+    hi = static_cast<uint64_t>(t >> 64);
+    return static_cast<uint64_t>(t);
+#elif defined(_M_X64)
+    unsigned long long h;
+    unsigned long long lo = _umul128(a, b, &h);
+    h += _addcarry_u64(0, lo, c, &lo);
+    h += _addcarry_u64(0, lo, d, &lo);
+    hi = h;
+    return lo;
+#else
+    uint64_t aLo = a & 0xFFFFFFFF, aHi = a >> 32;
+    uint64_t bLo = b & 0xFFFFFFFF, bHi = b >> 32;
+    uint64_t ll = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+    uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+    uint64_t lo = (mid << 32) | (ll & 0xFFFFFFFF);
+    uint64_t h = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    unsigned char carry = 0;
+    lo = addCarry(lo, c, carry);
+    h += carry;
+    carry = 0;
+    lo = addCarry(lo, d, carry);
+    hi = h + carry;
+    return lo;
+#endif
+}
+
+// r[0..rn) += a[0..an), an <= rn; возвращает перенос из старшего слова
+inline unsigned char addInto(uint64_t* r, size_t rn, const uint64_t* a, size_t an) noexcept {
+    unsigned char carry = 0;
+    size_t i = 0;
+    for (; i < an; ++i) {
+        r[i] = addCarry(r[i], a[i], carry);
+    }
+    for (; carry != 0 && i < rn; ++i) {
+        r[i] = addCarry(r[i], 0, carry);
+    }
+    return carry;
+}
+
+// r[0..rn) -= a[0..an), an <= rn; возвращает заём из старшего слова
+inline unsigned char subInto(uint64_t* r, size_t rn, const uint64_t* a, size_t an) noexcept {
+    unsigned char borrow = 0;
+    size_t i = 0;
+    for (; i < an; ++i) {
+        r[i] = subBorrow(r[i], a[i], borrow);
+    }
+    for (; borrow != 0 && i < rn; ++i) {
+        r[i] = subBorrow(r[i], 0, borrow);
+    }
+    return borrow;
+}
+
+// Умножение "в столбик": r[0..n+m) = a[0..n) * b[0..m)
+void mulSchoolbook(const uint64_t* a, size_t n, const uint64_t* b, size_t m, uint64_t* r) noexcept {
+    std::fill(r, r + n + m, 0);
+    for (size_t j = 0; j < m; ++j) {
+        uint64_t bj = b[j];
+        if (bj == 0) continue;
+        uint64_t carry = 0;
+        for (size_t i = 0; i < n; ++i) {
+            r[i + j] = mulAdd(a[i], bj, r[i + j], carry, carry);
+        }
+        r[n + j] = carry;
+    }
+}
+
+void mulLimbs(const uint64_t* a, size_t n, const uint64_t* b, size_t m, uint64_t* r, size_t threshold);
+
+// Карацуба для операндов равной длины n: r[0..2n) = a * b
+void mulKaratsuba(const uint64_t* a, const uint64_t* b, size_t n, uint64_t* r, size_t threshold) {
+    size_t lo = n / 2;      // a = a1 * B^lo + a0
+    size_t hi = n - lo;
+
+    // z0 = a0 * b0 -> r[0..2lo), z2 = a1 * b1 -> r[2lo..2n)
+    mulLimbs(a, lo, b, lo, r, threshold);
+    mulLimbs(a + lo, hi, b + lo, hi, r + 2 * lo, threshold);
+
+    // z1 = (a0 + a1) * (b0 + b1) - z0 - z2
+    std::vector<uint64_t> sa(hi + 1), sb(hi + 1), z1(2 * (hi + 1));
+    std::copy(a + lo, a + n, sa.begin());
+    std::copy(b + lo, b + n, sb.begin());
+    sa[hi] = addInto(sa.data(), hi, a, lo);
+    sb[hi] = addInto(sb.data(), hi, b, lo);
+    mulLimbs(sa.data(), hi + 1, sb.data(), hi + 1, z1.data(), threshold);
+    subInto(z1.data(), z1.size(), r, 2 * lo);
+    subInto(z1.data(), z1.size(), r + 2 * lo, 2 * hi);
+
+    // r += z1 * B^lo (старшие слова z1 за пределами результата нулевые)
+    size_t z1Size = z1.size();
+    while (z1Size > 0 && z1[z1Size - 1] == 0) --z1Size;
+    addInto(r + lo, 2 * n - lo, z1.data(), z1Size);
+}
+
+// Общее умножение: r[0..n+m) = a[0..n) * b[0..m)
+void mulLimbs(const uint64_t* a, size_t n, const uint64_t* b, size_t m, uint64_t* r, size_t threshold) {
+    if (n < m) {
+        std::swap(a, b);
+        std::swap(n, m);
+    }
+    if (m < threshold) {
+        mulSchoolbook(a, n, b, m, r);
+        return;
+    }
+    if (n == m) {
+        mulKaratsuba(a, b, n, r, threshold);
+        return;
+    }
+
+    // Несбалансированные операнды: a режется на куски длины m, произведения складываются со сдвигом
+    std::fill(r, r + n + m, 0);
+    std::vector<uint64_t> part(2 * m);
+    for (size_t offset = 0; offset < n; offset += m) {
+        size_t chunk = std::min(m, n - offset);
+        mulLimbs(a + offset, chunk, b, m, part.data(), threshold);
+        addInto(r + offset, n + m - offset, part.data(), chunk + m);
+    }
+}
+
+
+// (hi * 2^64 + lo) / d при hi < d: частное возвращается, остаток записывается в rem
+inline uint64_t div128(uint64_t hi, uint64_t lo, uint64_t d, uint64_t& rem) noexcept {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 num = (static_cast<unsigned __int128>(hi) << 64) | lo;
+    rem = static_cast<uint64_t>(num % d);
+    return static_cast<uint64_t>(num / d);
+#elif defined(_M_X64) && defined(_MSC_VER) && _MSC_VER >= 1920
+    unsigned long long r;
+    uint64_t q = _udiv128(hi, lo, d, &r);
+    rem = r;
+    return q;
+#else
+    uint64_t q = 0;
+    for (int i = 0; i < 64; ++i) {
+        uint64_t top = hi >> 63;
+        hi = (hi << 1) | (lo >> 63);
+        lo <<= 1;
+        q <<= 1;
+        if (top != 0 || hi >= d) {
+            hi -= d;
+            q |= 1;
+        }
+    }
+    rem = hi;
+    return q;
+#endif
+}
+
+// Деление Кнута (алгоритм D): q[0..m-n+1) = u / v, r[0..n) = u % v; m >= n, v[n-1] != 0
+void divLimbs(const uint64_t* u, size_t m, const uint64_t* v, size_t n, uint64_t* q, uint64_t* r) {
+    if (n == 1) {
+        uint64_t rem = 0;
+        for (size_t i = m; i > 0; --i) {
+            q[i - 1] = div128(rem, u[i - 1], v[0], rem);
+        }
+        r[0] = rem;
+        return;
+    }
+
+    // Нормализация: старший бит делителя должен быть установлен
+    int shift = std::countl_zero(v[n - 1]);
+    std::vector<uint64_t> un(m + 1), vn(n);
+    for (size_t i = n; i-- > 0;) {
+        vn[i] = (v[i] << shift) | (shift != 0 && i > 0 ? v[i - 1] >> (64 - shift) : 0);
+    }
+    un[m] = shift != 0 ? u[m - 1] >> (64 - shift) : 0;
+    for (size_t i = m; i-- > 0;) {
+        un[i] = (u[i] << shift) | (shift != 0 && i > 0 ? u[i - 1] >> (64 - shift) : 0);
+    }
+
+    uint64_t vTop = vn[n - 1];
+    uint64_t vNext = vn[n - 2];
+    for (size_t j = m - n + 1; j-- > 0;) {
+        // Оценка цифры частного по двум старшим словам с последующей коррекцией
+        uint64_t qhat, rhat;
+        bool rhatOverflow = false;
+        if (un[j + n] >= vTop) {
+            qhat = ~uint64_t(0);
+            rhat = un[j + n - 1] + vTop;
+            rhatOverflow = rhat < vTop;
+        } else {
+            qhat = div128(un[j + n], un[j + n - 1], vTop, rhat);
+        }
+        while (!rhatOverflow) {
+            uint64_t phi;
+            uint64_t plo = mulAdd(qhat, vNext, 0, 0, phi);
+            if (phi < rhat || (phi == rhat && plo <= un[j + n - 2])) break;
+            --qhat;
+            rhat += vTop;
+            rhatOverflow = rhat < vTop;
+        }
+
+        // un[j..j+n] -= qhat * vn
+        uint64_t carry = 0;
+        unsigned char borrow = 0;
+        for (size_t i = 0; i < n; ++i) {
+            uint64_t plo = mulAdd(qhat, vn[i], carry, 0, carry);
+            un[i + j] = subBorrow(un[i + j], plo, borrow);
+        }
+        un[j + n] = subBorrow(un[j + n], carry, borrow);
+
+        // Оценка оказалась на единицу больше - возвращаем делитель обратно
+        if (borrow != 0) {
+            --qhat;
+            un[j + n] += addInto(un.data() + j, n, vn.data(), n);
+        }
+        q[j] = qhat;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        r[i] = (un[i] >> shift) | (shift != 0 ? un[i + 1] << (64 - shift) : 0);
+    }
+}
+
+// Умножение Монтгомери по нечётному модулю из len слов (CIOS)
+class Montgomery {
+public:
+    Montgomery(const uint64_t* modulus, size_t len) : modulus(modulus), len(len), t(len + 2) {
+        // -N^-1 mod 2^64 методом Ньютона: каждая итерация удваивает число верных битов
+        uint64_t inv = modulus[0];
+        for (int i = 0; i < 6; ++i) {
+            inv *= 2 - modulus[0] * inv;
+        }
+        negInv = ~inv + 1;
+    }
+
+    // r = a * b * R^-1 mod N, где R = 2^(64 * len); a, b < N; r может совпадать с a или b
+    void multiply(const uint64_t* a, const uint64_t* b, uint64_t* r) {
+        std::fill(t.begin(), t.end(), 0);
+        for (size_t i = 0; i < len; ++i) {
+            uint64_t carry = 0;
+            for (size_t j = 0; j < len; ++j) {
+                t[j] = mulAdd(a[j], b[i], t[j], carry, carry);
+            }
+            unsigned char c = 0;
+            t[len] = addCarry(t[len], carry, c);
+            t[len + 1] = c;
+
+            uint64_t m = t[0] * negInv;
+            mulAdd(m, modulus[0], t[0], 0, carry); // Младшее слово обнуляется
+            for (size_t j = 1; j < len; ++j) {
+                t[j - 1] = mulAdd(m, modulus[j], t[j], carry, carry);
+            }
+            c = 0;
+            t[len - 1] = addCarry(t[len], carry, c);
+            t[len] = t[len + 1] + c;
+        }
+
+        // t < 2N: одно условное вычитание
+        bool reduce = t[len] != 0;
+        if (!reduce) {
+            reduce = true;
+            for (size_t i = len; i > 0; --i) {
+                if (t[i - 1] != modulus[i - 1]) {
+                    reduce = t[i - 1] > modulus[i - 1];
+                    break;
+                }
+            }
+        }
+        if (reduce) {
+            subInto(t.data(), len + 1, modulus, len);
+        }
+        std::copy(t.begin(), t.begin() + len, r);
+    }
+
+private:
+    const uint64_t* modulus;
+    size_t len;
+    uint64_t negInv;
+    std::vector<uint64_t> t;
+};
+
+// Возведение в степень окном в одну шестнадцатеричную цифру показателя:
+// на каждую цифру - 4 возведения в квадрат и не более одного умножения на base^digit
+template <class T, class Digit, class Mul>
+T powWindow(size_t digits, Digit digit, const T& one, const T& base, Mul mul) {
+    std::vector<T> table(16, one);
+    table[1] = base;
+    for (size_t k = 2; k < 16; ++k) {
+        table[k] = mul(table[k - 1], base);
+    }
+
+    T result = one;
+    for (size_t i = digits; i > 0; --i) {
+        if (i != digits) {
+            for (int s = 0; s < 4; ++s) {
+                result = mul(result, result);
+            }
+        }
+        unsigned char d = digit(i - 1);
+        if (d != 0) {
+            result = mul(result, table[d]);
+        }
+    }
+    return result;
+}
+
+// Слагаемое однопроходной суммы: слова и маска (~0 для вычитаемого)
+struct SumOperand {
+    const uint64_t* limbs;
+    size_t count;
+    uint64_t mask;
+};
+
+// r[0..n) = сумма первых n слов слагаемых плюс входной перенос; возвращает выходной перенос.
+// N > 0 - число слагаемых известно при компиляции, N == 0 - передаётся в count
+template <size_t N>
+uint64_t sumOperands(uint64_t* r, const SumOperand* operands, size_t n, uint64_t carry,
+                     size_t count = N) noexcept {
+    const size_t terms = N > 0 ? N : count;
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t lo = carry;
+        uint64_t hi = 0;
+        for (size_t t = 0; t < terms; ++t) {
+            unsigned char flag = 0;
+            lo = addCarry(lo, operands[t].limbs[i] ^ operands[t].mask, flag);
+            hi += flag;
+        }
+        r[i] = lo;
+        carry = hi;
+    }
+    return carry;
+}
+
+// Побитовые операции над словами: скалярная и векторные формы
+struct AndWords {
+    uint64_t operator()(uint64_t a, uint64_t b) const noexcept { return a & b; }
+#if defined(__AVX2__)
+    __m256i operator()(__m256i a, __m256i b) const noexcept { return _mm256_and_si256(a, b); }
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+    __m128i operator()(__m128i a, __m128i b) const noexcept { return _mm_and_si128(a, b); }
+#endif
+};
+
+struct OrWords {
+    uint64_t operator()(uint64_t a, uint64_t b) const noexcept { return a | b; }
+#if defined(__AVX2__)
+    __m256i operator()(__m256i a, __m256i b) const noexcept { return _mm256_or_si256(a, b); }
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+    __m128i operator()(__m128i a, __m128i b) const noexcept { return _mm_or_si128(a, b); }
+#endif
+};
+
+struct XorWords {
+    uint64_t operator()(uint64_t a, uint64_t b) const noexcept { return a ^ b; }
+#if defined(__AVX2__)
+    __m256i operator()(__m256i a, __m256i b) const noexcept { return _mm256_xor_si256(a, b); }
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+    __m128i operator()(__m128i a, __m128i b) const noexcept { return _mm_xor_si128(a, b); }
+#endif
+};
+
+// r[0..n) = a[i] op b[i]: по 4 слова с AVX2, по 2 с SSE2, остаток - скалярно
+template <class Op>
+void bitwiseWords(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, Op op) noexcept {
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 4 <= n; i += 4) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), op(va, vb));
+    }
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+    for (; i + 2 <= n; i += 2) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(r + i), op(va, vb));
+    }
+#endif
+    for (; i < n; ++i) {
+        r[i] = op(a[i], b[i]);
+    }
+}
+
+// r[0..n] = a[0..n) << shift, 0 < shift < 64: слово результата склеивается из двух соседних слов
+void shiftWordsLeft(uint64_t* r, const uint64_t* a, size_t n, unsigned shift) noexcept {
+    const unsigned back = 64 - shift;
+    r[n] = a[n - 1] >> back;
+    size_t i = n - 1;
+#if defined(__AVX2__)
+    const __m128i left = _mm_cvtsi32_si128(static_cast<int>(shift));
+    const __m128i right = _mm_cvtsi32_si128(static_cast<int>(back));
+    for (; i >= 4; i -= 4) { // Слова i-3..i из a[i-3..i] и a[i-4..i-1]
+        __m256i cur = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i - 3));
+        __m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i - 4));
+        __m256i v = _mm256_or_si256(_mm256_sll_epi64(cur, left), _mm256_srl_epi64(prev, right));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i - 3), v);
+    }
+#endif
+    for (; i > 0; --i) {
+        r[i] = (a[i] << shift) | (a[i - 1] >> back);
+    }
+    r[0] = a[0] << shift;
+}
+
+// r[0..n) = a[0..n) >> shift, 0 < shift < 64
+void shiftWordsRight(uint64_t* r, const uint64_t* a, size_t n, unsigned shift) noexcept {
+    const unsigned back = 64 - shift;
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m128i right = _mm_cvtsi32_si128(static_cast<int>(shift));
+    const __m128i left = _mm_cvtsi32_si128(static_cast<int>(back));
+    for (; i + 5 <= n; i += 4) { // Слова i..i+3 из a[i..i+3] и a[i+1..i+4]
+        __m256i cur = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 1));
+        __m256i v = _mm256_or_si256(_mm256_srl_epi64(cur, right), _mm256_sll_epi64(next, left));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), v);
+    }
+#endif
+    for (; i + 1 < n; ++i) {
+        r[i] = (a[i] >> shift) | (a[i + 1] << back);
+    }
+    r[n - 1] = a[n - 1] >> shift;
+}
+
+// Количество единичных битов в a[0..n)
+size_t popcountWords(const uint64_t* a, size_t n) noexcept {
+    size_t count = 0;
+    size_t i = 0;
+#if defined(__AVX2__)
+    // Таблица битов для полубайтов (vpshufb), суммы байтов накапливаются через vpsadbw
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    __m256i total = _mm256_setzero_si256();
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i bits = _mm256_add_epi8(_mm256_shuffle_epi8(table, _mm256_and_si256(v, low)),
+                                       _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), low)));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(bits, _mm256_setzero_si256()));
+    }
+    count = static_cast<size_t>(_mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1) +
+                                _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3));
+#elif (defined(__SSE2__) || defined(_M_X64)) && !defined(__POPCNT__)
+    // Без инструкции popcnt: параллельный подсчёт по 2, 4, 8 битов, суммы байтов - через psadbw
+    __m128i total = _mm_setzero_si128();
+    for (; i + 2 <= n; i += 2) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi64(v, 1), _mm_set1_epi8(0x55)));
+        v = _mm_add_epi8(_mm_and_si128(v, _mm_set1_epi8(0x33)),
+                         _mm_and_si128(_mm_srli_epi64(v, 2), _mm_set1_epi8(0x33)));
+        v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi64(v, 4)), _mm_set1_epi8(0x0F));
+        total = _mm_add_epi64(total, _mm_sad_epu8(v, _mm_setzero_si128()));
+    }
+    count = static_cast<size_t>(_mm_cvtsi128_si64(total) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(total, total)));
+#endif
+    for (; i < n; ++i) {
+        count += static_cast<size_t>(std::popcount(a[i]));
+    }
+    return count;
+}
+
+} // namespace
+
+// Порог (в 64-битных словах), начиная с которого используется умножение Карацубы
+size_t Hex::karatsubaThreshold = 32;
 
 // Конструктор по умолчанию (число 0)
-Hex::Hex() : size(1) {
-    digits = new unsigned char[1];
-    digits[0] = 0;
+Hex::Hex() : limbs(inlineLimbs), size(1), capacity(kInlineLimbs) {
+    limbs[0] = 0;
 }
 
 // Конструктор с размером и значением
-Hex::Hex(const size_t& n, unsigned char t) : size(n) {
+Hex::Hex(const size_t& n, unsigned char t) : limbs(inlineLimbs), size(n), capacity(kInlineLimbs) {
     if (n == 0) throw std::invalid_argument("Size cannot be zero");
-    digits = new unsigned char[n];
-    for (size_t i = 0; i < n; ++i) {
-        digits[i] = t & 0x0F; // Оставляем только младшие 4 бита
+    size_t count = limbsFor(n);
+    allocate(count);
+    uint64_t pattern = (t & 0x0F) * 0x1111111111111111ULL; // Оставляем только младшие 4 бита
+    std::fill(limbs, limbs + count, pattern);
+    size_t tail = n % kDigitsPerLimb;
+    if (tail != 0) {
+        limbs[count - 1] &= (uint64_t(1) << (4 * tail)) - 1;
     }
     normalize();
 }
 
 // Конструктор из списка инициализации
-Hex::Hex(const std::initializer_list<unsigned char>& list) : size(list.size()) {
+Hex::Hex(const std::initializer_list<unsigned char>& list)
+    : limbs(inlineLimbs), size(list.size()), capacity(kInlineLimbs) {
     if (list.size() == 0) throw std::invalid_argument("Initializer list cannot be empty");
-    digits = new unsigned char[size];
+    size_t count = limbsFor(size);
+    allocate(count);
+    std::fill(limbs, limbs + count, 0);
     size_t i = 0;
     for (auto it = list.begin(); it != list.end(); ++it, ++i) {
-        digits[i] = *it & 0x0F;
+        limbs[i / kDigitsPerLimb] |= uint64_t(*it & 0x0F) << (4 * (i % kDigitsPerLimb));
     }
     normalize();
 }
 
-// Конструктор из строки
-Hex::Hex(const std::string& str) {
+// Разбор строки блоками по 16 символов на слово (32 символа на два слова с AVX2), старшее
+// неполное слово - скалярно
+void Hex::parse(std::string_view str) {
+    bool minus = !str.empty() && str[0] == '-';
+    if (minus) str.remove_prefix(1);
     if (str.empty()) throw std::invalid_argument("String cannot be empty");
-    
     size = str.length();
-    digits = new unsigned char[size];
-    
-    for (size_t i = 0; i < size; ++i) {
-        digits[size - 1 - i] = charToDigit(str[i]); // Старший разряд в конце строки -> младший в начале массива
+
+    size_t count = limbsFor(size);
+    allocate(count);
+
+    const char* text = str.data();
+    size_t end = size; // Конец текста, соответствующего слову i
+    size_t i = 0;
+    bool valid = true;
+#if defined(__AVX2__)
+    for (; valid && i + 1 < count && end >= 2 * kDigitsPerLimb; i += 2, end -= 2 * kDigitsPerLimb) {
+        valid = decode32(text + end - 2 * kDigitsPerLimb, limbs[i + 1], limbs[i]);
+    }
+#endif
+    for (; valid && end >= kDigitsPerLimb; ++i, end -= kDigitsPerLimb) {
+        valid = decode16(text + end - kDigitsPerLimb, limbs[i]);
+    }
+    if (valid && end > 0) {
+        valid = decodeScalar(text, end, limbs[i]);
+    }
+
+    if (!valid) {
+        release();
+        for (char c : str) {
+            charToDigit(c); // Бросает исключение с первым недопустимым символом
+        }
+        throw std::invalid_argument("Invalid hexadecimal string");
     }
     normalize();
+    negative = minus && !isZero();
+}
+
+Hex Hex::fromWords(std::span<const uint64_t> words, std::pmr::memory_resource* resource) {
+    Hex result(resource);
+    if (words.empty()) return result;
+    result.allocate(words.size());
+    std::copy(words.begin(), words.end(), result.limbs);
+    result.size = words.size() * kDigitsPerLimb;
+    result.normalize();
+    return result;
 }
 
 // Конструктор копирования
-Hex::Hex(const Hex& other) : size(other.size) {
-    digits = new unsigned char[size];
-    for (size_t i = 0; i < size; ++i) {
-        digits[i] = other.digits[i];
-    }
+Hex::Hex(const Hex& other)
+    : limbs(inlineLimbs), size(other.size), capacity(kInlineLimbs), negative(other.negative) {
+    size_t count = other.limbCount();
+    allocate(count);
+    std::copy(other.limbs, other.limbs + count, limbs);
+}
+
+Hex::Hex(const Hex& other, std::pmr::memory_resource* resource)
+    : limbs(inlineLimbs), size(other.size), capacity(kInlineLimbs), resource(resource),
+      negative(other.negative) {
+    size_t count = other.limbCount();
+    allocate(count);
+    std::copy(other.limbs, other.limbs + count, limbs);
 }
 
-// Конструктор перемещения
-Hex::Hex(Hex&& other) noexcept : digits(other.digits), size(other.size) {
-    other.digits = nullptr;
+// Конструктор перемещения: память кучи забирается вместе с ресурсом, встроенный буфер копируется.
+// У перемещённого объекта размер 0 и одно нулевое встроенное слово
+Hex::Hex(Hex&& other) noexcept
+    : limbs(inlineLimbs), size(other.size), capacity(kInlineLimbs), resource(other.resource),
+      negative(other.negative) {
+    if (other.isInline()) {
+        std::copy(other.inlineLimbs, other.inlineLimbs + kInlineLimbs, inlineLimbs);
+    } else {
+        limbs = other.limbs;
+        capacity = other.capacity;
+        other.limbs = other.inlineLimbs;
+        other.capacity = kInlineLimbs;
+    }
+    other.inlineLimbs[0] = 0;
     other.size = 0;
+    other.negative = false;
 }
 
 // Деструктор
 Hex::~Hex() noexcept {
-    delete[] digits;
+    release();
 }
 
-// Нормализация (удаление ведущих нулей)
-void Hex::normalize() {
-    size_t newSize = size;
-    while (newSize > 1 && digits[newSize - 1] == 0) {
-        --newSize;
+// Присваивание копированием
+Hex& Hex::operator=(const Hex& other) {
+    if (this != &other) {
+        size_t count = other.limbCount();
+        allocate(count);
+        std::copy(other.limbs, other.limbs + count, limbs);
+        size = other.size;
+        negative = other.negative;
     }
-    
-    if (newSize != size) {
-        unsigned char* newDigits = new unsigned char[newSize];
-        for (size_t i = 0; i < newSize; ++i) {
-            newDigits[i] = digits[i];
+    return *this;
+}
+
+// Присваивание перемещением: память из другого ресурса не забирается, а копируется
+Hex& Hex::operator=(Hex&& other) {
+    if (this != &other) {
+        if (!other.isInline() && resource != other.resource && *resource != *other.resource) {
+            return *this = static_cast<const Hex&>(other);
+        }
+        if (other.isInline()) {
+            std::copy(other.inlineLimbs, other.inlineLimbs + kInlineLimbs, limbs);
+        } else {
+            release();
+            limbs = other.limbs;
+            capacity = other.capacity;
+            other.limbs = other.inlineLimbs;
+            other.capacity = kInlineLimbs;
         }
-        delete[] digits;
-        digits = newDigits;
-        size = newSize;
+        size = other.size;
+        negative = other.negative;
+        other.inlineLimbs[0] = 0;
+        other.size = 0;
+        other.negative = false;
     }
+    return *this;
+}
+
+// Выделение хранилища: до kInlineLimbs слов используется встроенный буфер
+void Hex::allocate(size_t count) {
+    if (count <= capacity) return;
+    uint64_t* newLimbs = static_cast<uint64_t*>(resource->allocate(count * sizeof(uint64_t), alignof(uint64_t)));
+    release();
+    limbs = newLimbs;
+    capacity = count;
+}
+
+// Рост ёмкости с удвоением: используемые слова переносятся в новое хранилище
+void Hex::reserve(size_t count) {
+    if (count <= capacity) return;
+    size_t newCapacity = std::max(count, capacity * 2);
+    uint64_t* newLimbs =
+        static_cast<uint64_t*>(resource->allocate(newCapacity * sizeof(uint64_t), alignof(uint64_t)));
+    std::copy(limbs, limbs + limbCount(), newLimbs);
+    release();
+    limbs = newLimbs;
+    capacity = newCapacity;
+}
+
+// Освобождение памяти кучи
+void Hex::release() noexcept {
+    if (!isInline()) {
+        resource->deallocate(limbs, capacity * sizeof(uint64_t), alignof(uint64_t));
+        limbs = inlineLimbs;
+        capacity = kInlineLimbs;
+    }
+}
+
+bool Hex::isInline() const noexcept {
+    return limbs == inlineLimbs;
+}
+
+// Нормализация (удаление ведущих нулей): размер пересчитывается по старшему ненулевому слову
+void Hex::normalize() {
+    size_t count = limbCount();
+    while (count > 1 && limbs[count - 1] == 0) {
+        --count;
+    }
+    uint64_t top = limbs[count - 1];
+    size_t topDigits = top == 0 ? 1 : (std::bit_width(top) + 3) / 4;
+    size = (count - 1) * kDigitsPerLimb + topDigits;
 }
 
 // Преобразование char в цифру
@@ -88,11 +809,19 @@ unsigned char Hex::charToDigit(char c) const {
     throw std::invalid_argument("Invalid hexadecimal digit: " + std::string(1, c));
 }
 
-// Преобразование цифры в char
-char Hex::digitToChar(unsigned char d) const {
-    d &= 0x0F;
-    if (d < 10) return '0' + d;
-    return 'A' + (d - 10);
+// Количество используемых слов: не меньше одного, в том числе у перемещённого объекта (size 0),
+// поэтому старшее слово limbs[limbCount() - 1] всегда существует
+size_t Hex::limbCount() const noexcept {
+    return limbsFor(std::max<size_t>(size, 1));
+}
+
+bool Hex::isZero() const noexcept {
+    return size == 0 || (size == 1 && limbs[0] == 0);
+}
+
+// i-я цифра (0 - младшая)
+unsigned char Hex::digitAt(size_t i) const noexcept {
+    return (limbs[i / kDigitsPerLimb] >> (4 * (i % kDigitsPerLimb))) & 0x0F;
 }
 
 // Получение размера
@@ -100,105 +829,489 @@ size_t Hex::getSize() const noexcept {
     return size;
 }
 
+bool Hex::isNegative() const noexcept {
+    return negative;
+}
+
+std::pmr::memory_resource* Hex::getResource() const noexcept {
+    return resource;
+}
+
 // Преобразование в строку
 std::string Hex::toString() const {
     if (size == 0) return "0";
-    std::string result;
-    for (size_t i = size; i > 0; --i) {
-        result += digitToChar(digits[i - 1]);
-    }
+    std::string result(size + negative, '0');
+    toChars(result.data());
     return result;
 }
 
+std::span<const uint64_t> Hex::words() const noexcept {
+    return {limbs, limbCount()};
+}
+
+size_t Hex::binarySize() const noexcept {
+    return (1 + limbCount()) * sizeof(uint64_t);
+}
+
+unsigned char* Hex::toBinary(unsigned char* out) const {
+    auto writeWord = [&out](uint64_t word) {
+        if constexpr (std::endian::native == std::endian::big) word = byteSwap(word);
+        std::memcpy(out, &word, sizeof(word));
+        out += sizeof(word);
+    };
+    // Перемещённый объект (size 0) записывается как 0 из одной цифры: число слов в файле
+    // определяется по числу цифр
+    writeWord(std::max<size_t>(size, 1) | static_cast<uint64_t>(negative) << 63);
+    for (size_t i = 0, n = limbCount(); i < n; ++i) {
+        writeWord(limbs[i]);
+    }
+    return out;
+}
+
+// Запись цифр в буфер: неполное старшее слово - скалярно, остальные - по 16 символов
+char* Hex::toChars(char* out) const {
+    if (size == 0) {
+        *out = '0';
+        return out + 1;
+    }
+
+    if (negative) *out++ = '-';
+    size_t count = limbCount();
+    size_t topDigits = size - (count - 1) * kDigitsPerLimb;
+    encodeScalar(limbs[count - 1], topDigits, out);
+    out += topDigits;
+    for (size_t i = count - 1; i > 0; --i) {
+        encode16(limbs[i - 1], out);
+        out += kDigitsPerLimb;
+    }
+    return out;
+}
+
 // Сложение
 Hex Hex::add(const Hex& other) const {
-    size_t maxSize = std::max(size, other.size) + 1;
-    unsigned char* resultDigits = new unsigned char[maxSize]();
-    
+    return addSigned(other, other.negative);
+}
+
+// Сложение со знаком otherNegative у other: модули одного знака складываются (перенос
+// распространяется сразу по 64-битным словам), разных - вычитаются
+Hex Hex::addSigned(const Hex& other, bool otherNegative) const {
+    if (negative != otherNegative) {
+        Hex result(resource);
+        result.assignDifference(*this, other, negative);
+        return result;
+    }
+
+    size_t count = limbCount();
+    size_t otherCount = other.limbCount();
+    size_t maxCount = std::max(count, otherCount);
+
+    // Лишнее слово под перенос нужно, только если старшие слова могут переполниться
+    uint64_t topA = count == maxCount ? limbs[maxCount - 1] : 0;
+    uint64_t topB = otherCount == maxCount ? other.limbs[maxCount - 1] : 0;
+    size_t resultCount = maxCount + (topA >= ~topB ? 1 : 0);
+
+    Hex result(resource);
+    result.allocate(resultCount);
+    uint64_t* resultLimbs = result.limbs;
+
     unsigned char carry = 0;
-    for (size_t i = 0; i < maxSize; ++i) {
-        unsigned char d1 = (i < size) ? digits[i] : 0;
-        unsigned char d2 = (i < other.size) ? other.digits[i] : 0;
-        
-        unsigned char sum = d1 + d2 + carry;
-        resultDigits[i] = sum & 0x0F;
-        carry = sum >> 4;
-    }
-    
-    Hex result;
-    delete[] result.digits;
-    result.digits = resultDigits;
-    result.size = maxSize;
+    for (size_t i = 0; i < maxCount; ++i) {
+        uint64_t a = (i < count) ? limbs[i] : 0;
+        uint64_t b = (i < otherCount) ? other.limbs[i] : 0;
+        resultLimbs[i] = addCarry(a, b, carry);
+    }
+    if (resultCount > maxCount) {
+        resultLimbs[maxCount] = carry;
+    }
+
+    result.size = resultCount * kDigitsPerLimb;
     result.normalize();
+    result.negative = negative;
     return result;
 }
 
-// Вычитание
+// Вычитание: знак результата известен после прохода с заёмом, отдельного сравнения нет
 Hex Hex::subtract(const Hex& other) const {
-    if (lessThan(other)) {
+    Hex result = addSigned(other, !other.negative);
+    if (result.negative) {
         throw std::invalid_argument("Result would be negative");
     }
-    
-    size_t maxSize = size;
-    unsigned char* resultDigits = new unsigned char[maxSize]();
-    
+    return result;
+}
+
+Hex Hex::subtractSigned(const Hex& other) const {
+    return addSigned(other, !other.negative);
+}
+
+// Разность модулей за один проход с заёмом. Если из старшего слова остался заём, в словах
+// записано 2^(64n) - (|b| - |a|), и модуль восстанавливается дополнением (~x + 1)
+void Hex::assignDifference(const Hex& a, const Hex& b, bool flip) {
+    size_t countA = a.limbCount();
+    size_t countB = b.limbCount();
+    size_t n = std::max<size_t>({countA, countB, 1});
+    bool inPlace = &a == this;
+    reserve(n);
+    const uint64_t* limbsA = a.limbs;
+    const uint64_t* limbsB = b.limbs;
+
     unsigned char borrow = 0;
-    for (size_t i = 0; i < maxSize; ++i) {
-        unsigned char d1 = digits[i];
-        unsigned char d2 = (i < other.size) ? other.digits[i] : 0;
-        
-        int diff = d1 - d2 - borrow;
-        if (diff < 0) {
-            diff += 16;
-            borrow = 1;
-        } else {
-            borrow = 0;
+    size_t common = std::min(countA, countB);
+    size_t i = 0;
+    for (; i < common; ++i) {
+        limbs[i] = subBorrow(limbsA[i], limbsB[i], borrow);
+    }
+    if (countA > countB) {
+        if (inPlace) {
+            // Старшие слова уже на месте: заём распространяется, только пока он не нулевой
+            for (; borrow != 0 && i < countA; ++i) {
+                limbs[i] = subBorrow(limbs[i], 0, borrow);
+            }
+            i = countA;
+        }
+        for (; i < countA; ++i) {
+            limbs[i] = subBorrow(limbsA[i], 0, borrow);
+        }
+    }
+    for (; i < countB; ++i) {
+        limbs[i] = subBorrow(0, limbsB[i], borrow);
+    }
+    for (; i < n; ++i) {
+        limbs[i] = 0;
+    }
+
+    bool below = borrow != 0;
+    if (below) {
+        unsigned char carry = 1;
+        for (size_t k = 0; k < n; ++k) {
+            limbs[k] = addCarry(~limbs[k], 0, carry);
         }
-        resultDigits[i] = diff;
     }
-    
-    Hex result;
-    delete[] result.digits;
-    result.digits = resultDigits;
-    result.size = maxSize;
+    size = n * kDigitsPerLimb;
+    normalize();
+    negative = below != flip && !isZero();
+}
+
+// Умножение: "в столбик" для коротких операндов, Карацуба - начиная с karatsubaThreshold слов
+Hex Hex::multiply(const Hex& other) const {
+    size_t count = limbCount();
+    size_t otherCount = other.limbCount();
+
+    Hex result(resource);
+    result.allocate(count + otherCount);
+    mulLimbs(limbs, count, other.limbs, otherCount, result.limbs,
+             std::max<size_t>(karatsubaThreshold, 4));
+
+    result.size = (count + otherCount) * kDigitsPerLimb;
+    result.normalize();
+    result.negative = negative != other.negative && !result.isZero();
+    return result;
+}
+
+// Деление с остатком (алгоритм D Кнута по 64-битным словам)
+std::pair<Hex, Hex> Hex::divmod(const Hex& divisor) const {
+    if (divisor.isZero()) {
+        throw std::invalid_argument("Division by zero");
+    }
+    if (compareMagnitude(divisor) < 0) {
+        return {Hex(resource), Hex(*this, resource)};
+    }
+
+    size_t count = limbCount();
+    size_t divisorCount = divisor.limbCount();
+    Hex quotient(resource);
+    Hex remainder(resource);
+    quotient.allocate(count - divisorCount + 1);
+    remainder.allocate(divisorCount);
+    divLimbs(limbs, count, divisor.limbs, divisorCount, quotient.limbs, remainder.limbs);
+
+    quotient.size = (count - divisorCount + 1) * kDigitsPerLimb;
+    quotient.normalize();
+    remainder.size = divisorCount * kDigitsPerLimb;
+    remainder.normalize();
+    quotient.negative = negative != divisor.negative && !quotient.isZero();
+    remainder.negative = negative && !remainder.isZero();
+    return {std::move(quotient), std::move(remainder)};
+}
+
+// Остаток от деления
+Hex Hex::mod(const Hex& modulus) const {
+    return divmod(modulus).second;
+}
+
+// Возведение в степень по модулю: нечётные модули от двух слов - через умножение Монтгомери,
+// остальные - через умножение и деление с остатком
+Hex Hex::powmod(const Hex& exponent, const Hex& modulus) const {
+    if (modulus.isZero()) {
+        throw std::invalid_argument("Division by zero");
+    }
+    if (modulus.negative) {
+        throw std::invalid_argument("Modulus must be positive");
+    }
+    if (exponent.negative) {
+        throw std::invalid_argument("Exponent must be non-negative");
+    }
+
+    // Отрицательное основание приводится в [0, modulus)
+    Hex base = mod(modulus);
+    if (base.negative) {
+        base += modulus;
+    }
+    if ((modulus.limbs[0] & 1) != 0 && modulus.limbCount() >= 2) {
+        return base.powmodMontgomery(exponent, modulus);
+    }
+
+    Hex one = Hex("1", resource).mod(modulus);
+    return powWindow(
+        exponent.size, [&](size_t i) { return exponent.digitAt(i); }, one, base,
+        [&](const Hex& a, const Hex& b) { return a.multiply(b).mod(modulus); });
+}
+
+// Возведение в степень в представлении Монтгомери (x -> x * R mod N)
+Hex Hex::powmodMontgomery(const Hex& exponent, const Hex& modulus) const {
+    size_t len = modulus.limbCount();
+    Montgomery monty(modulus.limbs, len);
+
+    // R^2 mod N и основание, приведённое по модулю
+    std::vector<uint64_t> r2(len);
+    {
+        std::vector<uint64_t> power(2 * len + 1, 0), quotient(len + 2);
+        power[2 * len] = 1;
+        divLimbs(power.data(), power.size(), modulus.limbs, len, quotient.data(), r2.data());
+    }
+    Hex reduced = mod(modulus);
+    std::vector<uint64_t> one(len, 0);
+    one[0] = 1;
+
+    // Таблица base^k * R mod N для k = 0..15, хранится подряд по len слов
+    std::vector<uint64_t> table(16 * len, 0);
+    std::copy(reduced.limbs, reduced.limbs + reduced.limbCount(), table.begin() + len);
+    monty.multiply(r2.data(), one.data(), table.data());
+    monty.multiply(table.data() + len, r2.data(), table.data() + len);
+    for (size_t k = 2; k < 16; ++k) {
+        monty.multiply(table.data() + (k - 1) * len, table.data() + len, table.data() + k * len);
+    }
+
+    // Окно в одну шестнадцатеричную цифру показателя, как в powWindow, но без временных буферов
+    std::vector<uint64_t> plain(table.begin(), table.begin() + len);
+    for (size_t i = exponent.size; i > 0; --i) {
+        if (i != exponent.size) {
+            for (int s = 0; s < 4; ++s) {
+                monty.multiply(plain.data(), plain.data(), plain.data());
+            }
+        }
+        unsigned char d = exponent.digitAt(i - 1);
+        if (d != 0) {
+            monty.multiply(plain.data(), table.data() + d * len, plain.data());
+        }
+    }
+    monty.multiply(plain.data(), one.data(), plain.data());
+
+    Hex result(resource);
+    result.allocate(len);
+    std::copy(plain.begin(), plain.end(), result.limbs);
+    result.size = len * kDigitsPerLimb;
     result.normalize();
     return result;
 }
 
 // Копирование
 Hex Hex::copy() const {
-    return Hex(*this);
+    return Hex(*this, resource);
+}
+
+Hex Hex::operator-() const {
+    Hex result(*this, resource);
+    result.negate();
+    return result;
+}
+
+Hex& Hex::negate() noexcept {
+    negative = !negative && !isZero();
+    return *this;
+}
+
+// Сдвиг влево: слова переносятся на bits / 64 позиций, внутри слова - склейка соседних слов
+Hex Hex::shiftLeft(size_t bits) const {
+    if (isZero()) return Hex(resource);
+    size_t count = limbCount();
+    size_t wordShift = bits / 64;
+    unsigned bitShift = static_cast<unsigned>(bits % 64);
+    size_t resultCount = count + wordShift + (bitShift != 0 ? 1 : 0);
+
+    Hex result(resource);
+    result.allocate(resultCount);
+    std::fill(result.limbs, result.limbs + wordShift, 0);
+    if (bitShift == 0) {
+        std::copy(limbs, limbs + count, result.limbs + wordShift);
+    } else {
+        shiftWordsLeft(result.limbs + wordShift, limbs, count, bitShift);
+    }
+    result.size = resultCount * kDigitsPerLimb;
+    result.normalize();
+    result.negative = negative;
+    return result;
+}
+
+// Сдвиг вправо: младшие bits / 64 слов отбрасываются без чтения
+Hex Hex::shiftRight(size_t bits) const {
+    size_t count = limbCount();
+    size_t wordShift = bits / 64;
+    if (isZero() || wordShift >= count) return Hex(resource);
+    unsigned bitShift = static_cast<unsigned>(bits % 64);
+    size_t resultCount = count - wordShift;
+
+    Hex result(resource);
+    result.allocate(resultCount);
+    if (bitShift == 0) {
+        std::copy(limbs + wordShift, limbs + count, result.limbs);
+    } else {
+        shiftWordsRight(result.limbs, limbs + wordShift, resultCount, bitShift);
+    }
+    result.size = resultCount * kDigitsPerLimb;
+    result.normalize();
+    result.negative = negative && !result.isZero();
+    return result;
+}
+
+// Сдвиг на цифры - сдвиг на 4 бита на цифру
+Hex Hex::shiftLeftDigits(size_t digits) const {
+    if (digits > SIZE_MAX / 4) throw std::length_error("Shift is too large");
+    return shiftLeft(digits * 4);
+}
+
+Hex Hex::shiftRightDigits(size_t digits) const {
+    if (digits >= size) return Hex(resource);
+    return shiftRight(digits * 4);
+}
+
+// Побитовые операции: общая часть слов - векторным ядром, хвост длинного операнда - копированием
+template <class Op>
+Hex Hex::combineWords(const Hex& other, Op op, bool keepTail) const {
+    size_t count = limbCount();
+    size_t otherCount = other.limbCount();
+    size_t common = std::min(count, otherCount);
+    size_t resultCount = keepTail ? std::max(count, otherCount) : common;
+    if (resultCount == 0) return Hex(resource);
+
+    Hex result(resource);
+    result.allocate(resultCount);
+    bitwiseWords(result.limbs, limbs, other.limbs, common, op);
+    const uint64_t* longer = count > otherCount ? limbs : other.limbs;
+    std::copy(longer + common, longer + resultCount, result.limbs + common);
+    result.size = resultCount * kDigitsPerLimb;
+    result.normalize();
+    return result;
+}
+
+Hex Hex::bitAnd(const Hex& other) const {
+    return combineWords(other, AndWords{}, false);
+}
+
+Hex Hex::bitOr(const Hex& other) const {
+    return combineWords(other, OrWords{}, true);
+}
+
+Hex Hex::bitXor(const Hex& other) const {
+    return combineWords(other, XorWords{}, true);
+}
+
+size_t Hex::popcount() const noexcept {
+    return popcountWords(limbs, limbCount());
+}
+
+Hex Hex::operator<<(size_t bits) const {
+    return shiftLeft(bits);
+}
+
+Hex Hex::operator>>(size_t bits) const {
+    return shiftRight(bits);
+}
+
+Hex Hex::operator&(const Hex& other) const {
+    return bitAnd(other);
+}
+
+Hex Hex::operator|(const Hex& other) const {
+    return bitOr(other);
+}
+
+Hex Hex::operator^(const Hex& other) const {
+    return bitXor(other);
+}
+
+// Сравнение со знаком: отрицательное меньше неотрицательного, у отрицательных порядок модулей обратный
+int Hex::compare(const Hex& other) const noexcept {
+    if (negative != other.negative) return negative ? -1 : 1;
+    int result = compareMagnitude(other);
+    return negative ? -result : result;
+}
+
+// Сравнение модулей словами: сначала по числу цифр, затем по первому различающемуся слову от старшего
+int Hex::compareMagnitude(const Hex& other) const noexcept {
+    if (size != other.size) return (size > other.size) - (size < other.size);
+    size_t i = limbCount();
+    while (i > 1 && limbs[i - 1] == other.limbs[i - 1]) {
+        --i;
+    }
+    if (i == 0) return 0;
+    uint64_t a = limbs[i - 1];
+    uint64_t b = other.limbs[i - 1];
+    return (a > b) - (a < b);
 }
 
 // Сравнение на равенство
 bool Hex::equals(const Hex& other) const noexcept {
-    if (size != other.size) return false;
-    for (size_t i = 0; i < size; ++i) {
-        if (digits[i] != other.digits[i]) return false;
-    }
-    return true;
+    return size == other.size && negative == other.negative && std::memcmp(limbs, other.limbs, limbCount() * sizeof(uint64_t)) == 0;
 }
 
 // Сравнение: больше
 bool Hex::greaterThan(const Hex& other) const {
-    if (size != other.size) return size > other.size;
-    for (size_t i = size; i > 0; --i) {
-        if (digits[i - 1] != other.digits[i - 1]) {
-            return digits[i - 1] > other.digits[i - 1];
-        }
-    }
-    return false;
+    return compare(other) > 0;
 }
 
 // Сравнение: меньше
 bool Hex::lessThan(const Hex& other) const {
-    if (size != other.size) return size < other.size;
-    for (size_t i = size; i > 0; --i) {
-        if (digits[i - 1] != other.digits[i - 1]) {
-            return digits[i - 1] < other.digits[i - 1];
-        }
+    return compare(other) < 0;
+}
+
+bool Hex::operator==(const Hex& other) const noexcept {
+    return equals(other);
+}
+
+std::strong_ordering Hex::operator<=>(const Hex& other) const noexcept {
+    return compare(other) <=> 0;
+}
+
+// Хеш: слова перемешиваются умножением в четырёх независимых цепочках (чтобы умножения
+// шли параллельно), затем цепочки сводятся финализатором MurmurHash3 (fmix64).
+// Старшие цифры нормализованного числа нулевые, поэтому равные числа дают равные слова
+size_t Hex::hash() const noexcept {
+    constexpr uint64_t kMultiplier = 0x9E3779B97F4A7C15ull;
+    auto mix = [](uint64_t h, uint64_t word) { return std::rotl((h ^ word) * kMultiplier, 31); };
+
+    size_t n = limbCount();
+    uint64_t lanes[4] = {(size ^ static_cast<uint64_t>(negative) << 63) * kMultiplier, 1, 2, 3};
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        lanes[0] = mix(lanes[0], limbs[i]);
+        lanes[1] = mix(lanes[1], limbs[i + 1]);
+        lanes[2] = mix(lanes[2], limbs[i + 2]);
+        lanes[3] = mix(lanes[3], limbs[i + 3]);
+    }
+    uint64_t h = lanes[0];
+    for (; i < n; ++i) {
+        h = mix(h, limbs[i]);
+    }
+    if (n >= 4) {
+        h = mix(mix(mix(h, lanes[1]), lanes[2]), lanes[3]);
     }
-    return false;
+
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB93FE1A85EC5ull;
+    h ^= h >> 33;
+    return static_cast<size_t>(h);
 }
 
 // Сложение с присваиванием
@@ -211,7 +1324,226 @@ Hex Hex::subtractAssign(const Hex& other) const {
     return subtract(other);
 }
 
-// Получение цифр (для тестирования)
-const unsigned char* Hex::getDigits() const noexcept {
+// Сложение и вычитание на месте: память выделяется, только если результат не помещается
+Hex& Hex::operator+=(const Hex& other) {
+    addInPlace(other, other.negative);
+    return *this;
+}
+
+Hex& Hex::operator-=(const Hex& other) {
+    addInPlace(other, !other.negative);
+    return *this;
+}
+
+// Модули разных знаков вычитаются; одного знака - складываются, и перенос распространяется
+// дальше other только пока он не нулевой
+void Hex::addInPlace(const Hex& other, bool otherNegative) {
+    if (negative != otherNegative) {
+        assignDifference(*this, other, negative);
+        return;
+    }
+
+    size_t count = limbCount();
+    size_t otherCount = other.limbCount();
+    size_t maxCount = std::max(count, otherCount);
+
+    uint64_t topA = count == maxCount ? limbs[maxCount - 1] : 0;
+    uint64_t topB = otherCount == maxCount ? other.limbs[maxCount - 1] : 0;
+    size_t resultCount = maxCount + (topA >= ~topB ? 1 : 0);
+
+    reserve(resultCount);
+    std::fill(limbs + count, limbs + resultCount, 0);
+
+    unsigned char carry = 0;
+    size_t i = 0;
+    for (; i < otherCount; ++i) {
+        limbs[i] = addCarry(limbs[i], other.limbs[i], carry);
+    }
+    for (; carry != 0 && i < resultCount; ++i) {
+        limbs[i] = addCarry(limbs[i], 0, carry);
+    }
+
+    size = resultCount * kDigitsPerLimb;
+    normalize();
+}
+
+// Сумма слагаемых со знаками за один проход. Вычитаемое x прибавляется как ~x + 1 по ширине
+// maxCount слов, поэтому внутренний цикл состоит только из сложений с переносом; лишние
+// 2^(64 * maxCount) от каждого вычитаемого учитываются в старшем переносе. Знак слагаемого -
+// знак в выражении, умноженный на знак значения
+void Hex::assignSum(const HexTerm* terms, size_t count) {
+    constexpr size_t kStackOperands = 8;
+    SumOperand stackOperands[kStackOperands];
+    std::vector<SumOperand> heapOperands;
+    SumOperand* operands = stackOperands;
+    if (count > kStackOperands) {
+        heapOperands.resize(count);
+        operands = heapOperands.data();
+    }
+
+    size_t maxCount = 1;
+    size_t minCount = SIZE_MAX;
+    uint64_t negativeCount = 0;
+    for (size_t t = 0; t < count; ++t) {
+        const Hex& value = *terms[t].value;
+        bool termNegative = terms[t].negative != value.negative;
+        operands[t] = {value.limbs, value.limbCount(), 0 - static_cast<uint64_t>(termNegative)};
+        maxCount = std::max(maxCount, operands[t].count);
+        minCount = std::min(minCount, operands[t].count);
+        negativeCount += termNegative;
+    }
+
+    // Приёмник может быть одним из слагаемых: слово i пишется после чтения слов i всех слагаемых.
+    // Буфер приёмника мог переехать в reserve - адреса слагаемых-приёмника обновляются
+    const uint64_t* oldLimbs = limbs;
+    reserve(maxCount);
+    for (size_t t = 0; t < count; ++t) {
+        if (operands[t].limbs == oldLimbs) operands[t].limbs = limbs;
+    }
+
+    uint64_t carry = negativeCount;
+    // Общая часть всех слагаемых - без проверок границ; для коротких цепочек цикл развёрнут
+    switch (count) {
+    case 2: carry = sumOperands<2>(limbs, operands, minCount, carry); break;
+    case 3: carry = sumOperands<3>(limbs, operands, minCount, carry); break;
+    case 4: carry = sumOperands<4>(limbs, operands, minCount, carry); break;
+    case 5: carry = sumOperands<5>(limbs, operands, minCount, carry); break;
+    case 6: carry = sumOperands<6>(limbs, operands, minCount, carry); break;
+    default: carry = sumOperands<0>(limbs, operands, minCount, carry, count); break;
+    }
+    size_t i = minCount;
+    for (; i < maxCount; ++i) {
+        uint64_t lo = carry;
+        uint64_t hi = 0;
+        for (size_t t = 0; t < count; ++t) {
+            uint64_t word = i < operands[t].count ? operands[t].limbs[i] : 0;
+            unsigned char flag = 0;
+            lo = addCarry(lo, word ^ operands[t].mask, flag);
+            hi += flag;
+        }
+        limbs[i] = lo;
+        carry = hi;
+    }
+
+    // Старшее слово суммы: carry - negativeCount. Если оно отрицательное (-k), модуль суммы
+    // k * 2^(64 * maxCount) - L вычисляется дополнением L с учётом переноса из него
+    size = maxCount * kDigitsPerLimb;
+    uint64_t top = carry - negativeCount;
+    negative = carry < negativeCount;
+    if (negative) {
+        unsigned char c = 1;
+        for (size_t k = 0; k < maxCount; ++k) {
+            limbs[k] = addCarry(~limbs[k], 0, c);
+        }
+        top = negativeCount - carry - 1 + c;
+    }
+    if (top > 0) {
+        reserve(maxCount + 1);
+        limbs[maxCount] = top;
+        size += kDigitsPerLimb;
+    }
+    normalize();
+    negative = negative && !isZero();
+}
+
+// Сумма в форме с отложенным переносом: слова складываются независимо, переполнение слова i
+// копится в carries[i + 1] и распространяется один раз в конце. Модули положительных и
+// отрицательных слагаемых копятся отдельно и вычитаются в конце
+Hex Hex::sumRange(const Hex* first, const Hex* last) {
+    size_t maxCount = 1;
+    bool anyNegative = false;
+    for (const Hex* it = first; it != last; ++it) {
+        maxCount = std::max(maxCount, it->limbCount());
+        anyNegative = anyNegative || it->negative;
+    }
+
+    const size_t width = maxCount + 1;
+    std::vector<uint64_t> words((anyNegative ? 2 : 1) * width, 0);
+    std::vector<uint64_t> carries((anyNegative ? 2 : 1) * width, 0);
+    for (const Hex* it = first; it != last; ++it) {
+        const uint64_t* src = it->limbs;
+        uint64_t* sum = words.data() + (it->negative ? width : 0);
+        uint64_t* carry = carries.data() + (it->negative ? width : 0);
+        for (size_t i = 0, n = it->limbCount(); i < n; ++i) {
+            sum[i] += src[i];
+            carry[i + 1] += sum[i] < src[i];
+        }
+    }
+
+    // Число слагаемых меньше 2^64, поэтому сумма помещается в maxCount + 1 слов
+    auto resolve = [&](size_t offset) {
+        Hex result;
+        result.allocate(width);
+        unsigned char carry = 0;
+        for (size_t i = 0; i < width; ++i) {
+            result.limbs[i] = addCarry(words[offset + i], carries[offset + i], carry);
+        }
+        result.size = width * kDigitsPerLimb;
+        result.normalize();
+        return result;
+    };
+    Hex result = resolve(0);
+    if (anyNegative) {
+        result.addInPlace(resolve(width), true);
+    }
+    return result;
+}
+
+Hex Hex::sum(std::span<const Hex> values) {
+    // Минимальное число значений на поток: меньшие части не окупают запуск потока
+    constexpr size_t kValuesPerThread = 1 << 14;
+
+    size_t threads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                      values.size() / kValuesPerThread);
+    return sum(values, threads);
+}
+
+Hex Hex::sum(std::span<const Hex> values, size_t threads) {
+    threads = std::min(threads, values.size());
+    if (threads <= 1) {
+        return sumRange(values.data(), values.data() + values.size());
+    }
+
+    std::vector<Hex> partial(threads);
+    std::vector<std::exception_ptr> errors(threads);
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(threads - 1);
+        size_t chunk = values.size() / threads;
+        size_t remainder = values.size() % threads;
+        const Hex* begin = values.data();
+        for (size_t t = 0; t < threads; ++t) {
+            const Hex* end = begin + chunk + (t < remainder ? 1 : 0);
+            if (t + 1 == threads) {
+                partial[t] = sumRange(begin, end); // Последняя часть - в вызывающем потоке
+            } else {
+                workers.emplace_back([&partial, &errors, t, begin, end] {
+                    try {
+                        partial[t] = sumRange(begin, end);
+                    } catch (...) {
+                        errors[t] = std::current_exception();
+                    }
+                });
+            }
+            begin = end;
+        }
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+
+    Hex result = std::move(partial[0]);
+    for (size_t t = 1; t < threads; ++t) {
+        result += partial[t];
+    }
+    return result;
+}
+
+// Получение цифр (для тестирования): распаковка слов в массив по одной цифре на байт
+std::vector<unsigned char> Hex::getDigits() const {
+    std::vector<unsigned char> digits(size);
+    for (size_t i = 0; i < size; ++i) {
+        digits[i] = digitAt(i);
+    }
     return digits;
 }
@@ -0,0 +1,143 @@
+#include "../include/HexFile.h"
+#include <bit>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Слова записей читаются прямо из отображённого файла
+static_assert(std::endian::native == std::endian::little, "HexFileReader requires a little-endian host");
+
+namespace {
+
+constexpr uint64_t kSignBit = 1ull << 63; // Знак числа
+
+// Количество цифр и слов записи по её префиксу
+inline size_t prefixDigits(uint64_t prefix) noexcept {
+    return static_cast<size_t>(prefix & ~kSignBit);
+}
+
+inline size_t wordsFor(size_t digits) noexcept {
+    return (digits + 15) / 16;
+}
+
+} // namespace
+
+HexView::HexView(const uint64_t* words, size_t digits, bool negative) noexcept
+    : limbs(words), digits(digits), negative(negative) {}
+
+std::span<const uint64_t> HexView::words() const noexcept {
+    return {limbs, wordsFor(digits)};
+}
+
+Hex HexView::toHex() const {
+    Hex result = Hex::fromWords(words());
+    if (negative) result.negate();
+    return result;
+}
+
+std::string HexView::toString() const {
+    return toHex().toString();
+}
+
+void writeHexFile(const std::string& path, std::span<const Hex> values) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) throw std::runtime_error("Cannot open " + path);
+
+    // Записи копятся в буфере и сбрасываются блоками
+    constexpr size_t kFlushSize = 1 << 20;
+    std::vector<unsigned char> buffer;
+    bool ok = true;
+    for (const Hex& value : values) {
+        size_t offset = buffer.size();
+        buffer.resize(offset + value.binarySize());
+        value.toBinary(buffer.data() + offset);
+        if (buffer.size() >= kFlushSize) {
+            ok = ok && std::fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+            buffer.clear();
+        }
+    }
+    if (!buffer.empty()) {
+        ok = ok && std::fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    }
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok) throw std::runtime_error("Cannot write " + path);
+}
+
+HexView HexFileReader::Iterator::operator*() const noexcept {
+    return HexView(position + 1, prefixDigits(*position), (*position & kSignBit) != 0);
+}
+
+HexFileReader::Iterator& HexFileReader::Iterator::operator++() noexcept {
+    position += 1 + wordsFor(prefixDigits(*position));
+    return *this;
+}
+
+HexFileReader::Iterator HexFileReader::Iterator::operator++(int) noexcept {
+    Iterator old = *this;
+    ++*this;
+    return old;
+}
+
+HexFileReader::HexFileReader(const std::string& path) {
+    size_t bytes = 0;
+#if !defined(_WIN32)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Cannot open " + path);
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Cannot open " + path);
+    }
+    bytes = static_cast<size_t>(st.st_size);
+    if (bytes > 0) { // mmap не отображает пустые файлы
+        void* view = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("Cannot map " + path);
+        }
+        ::madvise(view, bytes, MADV_SEQUENTIAL);
+        mapped = view;
+        mappedBytes = bytes;
+        data = static_cast<const uint64_t*>(view);
+    }
+    ::close(fd);
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) throw std::runtime_error("Cannot open " + path);
+    bytes = static_cast<size_t>(file.tellg());
+    buffer.resize((bytes + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(buffer.data()), bytes)) {
+        throw std::runtime_error("Cannot read " + path);
+    }
+    data = buffer.data();
+#endif
+
+    // Проверка структуры: записи целиком помещаются в файл
+    length = bytes / sizeof(uint64_t);
+    bool valid = bytes % sizeof(uint64_t) == 0;
+    for (size_t position = 0; valid && position < length; ++count) {
+        size_t words = wordsFor(prefixDigits(data[position]));
+        valid = words < length - position;
+        position += 1 + words;
+    }
+    if (!valid) {
+#if !defined(_WIN32)
+        if (mapped) ::munmap(mapped, mappedBytes);
+#endif
+        throw std::runtime_error("Corrupted hex file " + path);
+    }
+}
+
+HexFileReader::~HexFileReader() noexcept {
+#if !defined(_WIN32)
+    if (mapped) ::munmap(mapped, mappedBytes);
+#endif
+}
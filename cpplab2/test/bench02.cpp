@@ -0,0 +1,484 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <set>
+#include <unordered_map>
+#include "../include/Hex.h"
+#include "../include/HexFile.h"
+#include "../include/HexN.h"
+
+// Подсчёт выделений памяти: глобальные operator new/delete заменены на счётчик.
+// Счётчик атомарный: память выделяют и другие потоки (benchmark, рабочие потоки библиотеки)
+static std::atomic<size_t> allocationCount{0};
+
+// GCC после встраивания видит free() для указателя из operator new и предупреждает о
+// несоответствии, хотя замещающие operator new/delete здесь работают через malloc/free
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(size_t n) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t n) {
+    return operator new(n);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    std::free(p);
+}
+
+// Выровненные формы: через них выделяет память std::pmr::new_delete_resource
+void* operator new(size_t n, std::align_val_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    size_t align = static_cast<size_t>(alignment);
+#if defined(_MSC_VER)
+    if (void* p = _aligned_malloc(n ? n : 1, align)) return p;
+#else
+    if (void* p = std::aligned_alloc(align, (n + align) / align * align)) return p;
+#endif
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+#if defined(_MSC_VER)
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void operator delete(void* p, size_t, std::align_val_t alignment) noexcept {
+    operator delete(p, alignment);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+// Число из digits шестнадцатеричных цифр
+static std::string makeDigits(size_t digits, char seed = '7') {
+    std::string str(digits, seed);
+    str[0] = 'F';
+    return str;
+}
+
+// Запуск цикла замера с записью среднего числа выделений на итерацию
+template <class Body>
+static void measureAllocations(benchmark::State& state, Body body) {
+    size_t before = allocationCount.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        body();
+    }
+    size_t allocations = allocationCount.load(std::memory_order_relaxed) - before;
+    state.counters["allocs/op"] = benchmark::Counter(
+        static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+// Основной набор: размеры от 1 до 1M цифр, включая границу встроенного буфера (32 цифры).
+// bytes_per_second считается по длине текстового представления (одна цифра - один байт)
+static void digitSizes(benchmark::internal::Benchmark* b) {
+    for (int64_t digits : {1, 8, 16, 32, 33, 256, 4096, 65536, 1 << 20}) {
+        b->Arg(digits);
+    }
+}
+
+static void setDigitsProcessed(benchmark::State& state) {
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ConstructFromString(benchmark::State& state) {
+    const std::string str = makeDigits(state.range(0));
+    measureAllocations(state, [&] {
+        Hex value(str);
+        benchmark::DoNotOptimize(value);
+    });
+    setDigitsProcessed(state);
+}
+BENCHMARK(BM_ConstructFromString)->Apply(digitSizes);
+
+static void BM_ToString(benchmark::State& state) {
+    const Hex value(makeDigits(state.range(0), 'c'));
+    measureAllocations(state, [&] {
+        std::string text = value.toString();
+        benchmark::DoNotOptimize(text);
+    });
+    setDigitsProcessed(state);
+}
+BENCHMARK(BM_ToString)->Apply(digitSizes);
+
+static void BM_ToChars(benchmark::State& state) {
+    const Hex value(makeDigits(state.range(0), 'c'));
+    std::string buffer(value.getSize(), '\0');
+    measureAllocations(state, [&] {
+        benchmark::DoNotOptimize(value.toChars(buffer.data()));
+        benchmark::ClobberMemory();
+    });
+    setDigitsProcessed(state);
+}
+BENCHMARK(BM_ToChars)->Apply(digitSizes);
+
+static void BM_Copy(benchmark::State& state) {
+    const Hex value(makeDigits(state.range(0)));
+    measureAllocations(state, [&] {
+        Hex copy(value);
+        benchmark::DoNotOptimize(copy);
+    });
+    setDigitsProcessed(state);
+}
+BENCHMARK(BM_Copy)->Apply(digitSizes);
+
+// Перемещение туда и обратно: для длинных чисел память кучи не выделяется
+static void BM_Move(benchmark::State& state) {
+    Hex value(makeDigits(state.range(0)));
+    measureAllocations(state, [&] {
+        Hex moved(std::move(value));
+        value = std::move(moved);
+        benchmark::DoNotOptimize(value);
+    });
+    setDigitsProcessed(state);
+}
+BENCHMARK(BM_Move)->Apply(digitSizes);
+
+static void BM_Add(benchmark::State& state) {
+    const Hex a(makeDigits(state.range(0)));
+    const Hex b(makeDigits(state.range(0), '3'));
+    measureAllocations(state, [&] {
+        Hex sum = a.add(b);
+        benchmark::DoNotOptimize(sum);
+    });
+    setDigitsProcessed(state);
+}
+BENCHMARK(BM_Add)->Apply(digitSizes)->Arg(31);
+
+static void BM_Subtract(benchmark::State& state) {
+    const Hex a(makeDigits(state.range(0)));
+    const Hex b(makeDigits(state.range(0), '3'));
+    measureAllocations(state, [&] {
+        Hex diff = a.subtract(b);
+        benchmark::DoNotOptimize(diff);
+    });
+    setDigitsProcessed(state);
+}
+BENCHMARK(BM_Subtract)->Apply(digitSizes);
+
+// Вычитание с отрицательным результатом: знак определяется в проходе с заёмом, без исключений
+static void BM_SubtractSignedNegative(benchmark::State& state) {
+    const Hex a(makeDigits(state.range(0), '3'));
+    const Hex b(makeDigits(state.range(0)));
+    measureAllocations(state, [&] {
+        Hex diff = a.subtractSigned(b);
+        benchmark::DoNotOptimize(diff);
+    });
+    setDigitsProcessed(state);
+}
+BENCHMARK(BM_SubtractSignedNegative)->Apply(digitSizes);
+
+// Сравнение чисел одной длины, различающихся только младшей цифрой (худший случай)
+static void BM_Compare(benchmark::State& state) {
+    const std::string digits = makeDigits(state.range(0));
+    std::string other = digits;
+    other.back() = '8';
+    const Hex a(digits), b(other);
+    measureAllocations(state, [&] {
+        benchmark::DoNotOptimize(a <=> b);
+        benchmark::DoNotOptimize(a == b);
+    });
+    setDigitsProcessed(state);
+}
+BENCHMARK(BM_Compare)->Apply(digitSizes);
+
+// Битовые операции над словами (без преобразования через строку)
+static void BM_ShiftLeft(benchmark::State& state) {
+    const Hex a(makeDigits(state.range(0)));
+    measureAllocations(state, [&] {
+        Hex shifted = a << 13;
+        benchmark::DoNotOptimize(shifted);
+    });
+    setDigitsProcessed(state);
+}
+BENCHMARK(BM_ShiftLeft)->Apply(digitSizes);
+
+static void BM_ShiftRight(benchmark::State& state) {
+    const Hex a(makeDigits(state.range(0)));
+    measureAllocations(state, [&] {
+        Hex shifted = a >> 13;
+        benchmark::DoNotOptimize(shifted);
+    });
+    setDigitsProcessed(state);
+}
+BENCHMARK(BM_ShiftRight)->Apply(digitSizes);
+
+static void BM_BitXor(benchmark::State& state) {
+    const Hex a(makeDigits(state.range(0))), b(makeDigits(state.range(0), '5'));
+    measureAllocations(state, [&] {
+        Hex mixed = a ^ b;
+        benchmark::DoNotOptimize(mixed);
+    });
+    setDigitsProcessed(state);
+}
+BENCHMARK(BM_BitXor)->Apply(digitSizes);
+
+static void BM_Popcount(benchmark::State& state) {
+    const Hex a(makeDigits(state.range(0)));
+    measureAllocations(state, [&] {
+        benchmark::DoNotOptimize(a.popcount());
+    });
+    setDigitsProcessed(state);
+}
+BENCHMARK(BM_Popcount)->Apply(digitSizes);
+
+static void BM_AddAssignAccumulate(benchmark::State& state) {
+    const Hex step(makeDigits(state.range(0)));
+    Hex acc;
+    measureAllocations(state, [&] {
+        acc += step;
+        benchmark::DoNotOptimize(acc);
+    });
+}
+BENCHMARK(BM_AddAssignAccumulate)->Arg(8)->Arg(32)->Arg(256);
+
+static void BM_AddLoopAccumulate(benchmark::State& state) {
+    const Hex step(makeDigits(state.range(0)));
+    Hex acc;
+    measureAllocations(state, [&] {
+        acc = acc.add(step);
+        benchmark::DoNotOptimize(acc);
+    });
+}
+BENCHMARK(BM_AddLoopAccumulate)->Arg(8)->Arg(32)->Arg(256);
+
+// Цепочка a + b + c - d: вызовы add/subtract против ленивого выражения
+static void BM_ChainMethods(benchmark::State& state) {
+    const Hex a(makeDigits(state.range(0))), b(makeDigits(state.range(0), '3'));
+    const Hex c(makeDigits(state.range(0), '5')), d(makeDigits(state.range(0), '1'));
+    Hex result;
+    measureAllocations(state, [&] {
+        result = a.add(b).add(c).subtract(d);
+        benchmark::DoNotOptimize(result);
+    });
+}
+BENCHMARK(BM_ChainMethods)->Arg(32)->Arg(256)->Arg(4096);
+
+static void BM_ChainExpression(benchmark::State& state) {
+    const Hex a(makeDigits(state.range(0))), b(makeDigits(state.range(0), '3'));
+    const Hex c(makeDigits(state.range(0), '5')), d(makeDigits(state.range(0), '1'));
+    Hex result;
+    measureAllocations(state, [&] {
+        result = a + b + c - d;
+        benchmark::DoNotOptimize(result);
+    });
+}
+BENCHMARK(BM_ChainExpression)->Arg(32)->Arg(256)->Arg(4096);
+
+// Сумма набора из range(0) чисел по 64 цифры: цикл с += против Hex::sum
+static std::vector<Hex> makeValues(size_t count) {
+    std::vector<Hex> values;
+    values.reserve(count);
+    for (size_t k = 0; k < count; ++k) {
+        values.emplace_back(makeDigits(64, "0123456789ABCDEF"[k % 16]));
+    }
+    return values;
+}
+
+static void BM_SumLoop(benchmark::State& state) {
+    const std::vector<Hex> values = makeValues(state.range(0));
+    for (auto _ : state) {
+        Hex total;
+        for (const Hex& value : values) total += value;
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_SumLoop)->Arg(1 << 10)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+
+static void BM_Sum(benchmark::State& state) {
+    const std::vector<Hex> values = makeValues(state.range(0));
+    for (auto _ : state) {
+        Hex total = Hex::sum(values);
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_Sum)->Arg(1 << 10)->Arg(1 << 20)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+static void BM_Hash(benchmark::State& state) {
+    const Hex value(makeDigits(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::hash<Hex>{}(value));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) / 2);
+}
+BENCHMARK(BM_Hash)->Arg(8)->Arg(32)->Arg(256)->Arg(4096);
+
+// Поиск в хеш-таблице и упорядоченном множестве из 100k ключей по 32 цифры
+static std::vector<Hex> makeKeys(size_t count) {
+    std::vector<Hex> keys;
+    keys.reserve(count);
+    uint64_t state = 0x243F6A8885A308D3ull;
+    char buffer[33];
+    for (size_t k = 0; k < count; ++k) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        std::snprintf(buffer, sizeof(buffer), "%016llX%016llX", static_cast<unsigned long long>(state),
+                      static_cast<unsigned long long>(state ^ k));
+        keys.emplace_back(std::string_view(buffer, 32));
+    }
+    return keys;
+}
+
+static void BM_UnorderedMapFind(benchmark::State& state) {
+    const std::vector<Hex> keys = makeKeys(100000);
+    std::unordered_map<Hex, size_t> map;
+    for (size_t k = 0; k < keys.size(); ++k) map.emplace(keys[k], k);
+    size_t k = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(keys[k]));
+        k = (k + 1) % keys.size();
+    }
+}
+BENCHMARK(BM_UnorderedMapFind);
+
+static void BM_SetFind(benchmark::State& state) {
+    const std::vector<Hex> keys = makeKeys(100000);
+    std::set<Hex> set(keys.begin(), keys.end());
+    size_t k = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(set.find(keys[k]));
+        k = (k + 1) % keys.size();
+    }
+}
+BENCHMARK(BM_SetFind);
+
+// Сложение и сравнение фиксированной ширины против Hex тех же значений
+template <size_t Bits>
+static void BM_HexNAdd(benchmark::State& state) {
+    HexN<Bits> a(makeDigits(Bits / 4));
+    const HexN<Bits> b(makeDigits(Bits / 4, '3'));
+    measureAllocations(state, [&] {
+        a += b;
+        benchmark::DoNotOptimize(a);
+    });
+}
+BENCHMARK_TEMPLATE(BM_HexNAdd, 128);
+BENCHMARK_TEMPLATE(BM_HexNAdd, 256);
+BENCHMARK_TEMPLATE(BM_HexNAdd, 512);
+
+template <size_t Bits>
+static void BM_HexNCompare(benchmark::State& state) {
+    const HexN<Bits> a(makeDigits(Bits / 4));
+    HexN<Bits> b = a;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(b);
+        benchmark::DoNotOptimize(a <=> b);
+    }
+}
+BENCHMARK_TEMPLATE(BM_HexNCompare, 256);
+
+// Обход отображённого в память файла из range(0) записей по 64 цифры
+static void BM_ReadHexFile(benchmark::State& state) {
+    const std::string path = "bench02_values.bin";
+    writeHexFile(path, makeValues(state.range(0)));
+    HexFileReader reader(path);
+    size_t bytes = 0;
+    for (HexView view : reader) bytes += view.words().size_bytes() + sizeof(uint64_t);
+    for (auto _ : state) {
+        uint64_t checksum = 0;
+        for (HexView view : reader) checksum += view.words()[0];
+        benchmark::DoNotOptimize(checksum);
+    }
+    state.SetItemsProcessed(state.iterations() * reader.size());
+    state.SetBytesProcessed(state.iterations() * bytes);
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_ReadHexFile)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+// Пакет из 1M операций над числами по 48 цифр (каждый результат - в куче):
+// временные значения в ресурсе по умолчанию против монотонной арены, освобождаемой целиком
+template <bool useArena>
+static void BM_BatchOperations(benchmark::State& state) {
+    constexpr size_t kOperations = 1 << 20;
+    const Hex step(makeDigits(48, '3'));
+    const std::string start = makeDigits(48);
+    for (auto _ : state) {
+        std::pmr::monotonic_buffer_resource arena;
+        std::pmr::memory_resource* resource = useArena ? &arena : std::pmr::get_default_resource();
+        Hex acc(start, resource);
+        for (size_t i = 0; i < kOperations / 2; ++i) {
+            Hex up = acc.add(step);
+            Hex down = up.subtract(step);
+            benchmark::DoNotOptimize(down);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kOperations);
+}
+BENCHMARK_TEMPLATE(BM_BatchOperations, false)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_BatchOperations, true)->Unit(benchmark::kMillisecond);
+
+// Умножение при заданном пороге Карацубы; размер операндов - от 1 до 100k цифр
+template <size_t threshold>
+static void BM_Multiply(benchmark::State& state) {
+    const Hex a(makeDigits(state.range(0)));
+    const Hex b(makeDigits(state.range(0), 'B'));
+    size_t saved = Hex::karatsubaThreshold;
+    Hex::karatsubaThreshold = threshold;
+    for (auto _ : state) {
+        Hex product = a.multiply(b);
+        benchmark::DoNotOptimize(product);
+    }
+    Hex::karatsubaThreshold = saved;
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Multiply, SIZE_MAX)->RangeMultiplier(4)->Range(1, 100000);
+BENCHMARK_TEMPLATE(BM_Multiply, 4)->RangeMultiplier(4)->Range(1, 100000);
+BENCHMARK_TEMPLATE(BM_Multiply, 16)->RangeMultiplier(4)->Range(1, 100000);
+BENCHMARK_TEMPLATE(BM_Multiply, 32)->RangeMultiplier(4)->Range(1, 100000);
+BENCHMARK_TEMPLATE(BM_Multiply, 64)->RangeMultiplier(4)->Range(1, 100000);
+
+// Пропускная способность модульной арифметики для 256-, 1024- и 4096-битных операндов
+static void BM_DivMod(benchmark::State& state) {
+    const size_t digits = state.range(0) / 4;
+    const Hex dividend(makeDigits(2 * digits));
+    const Hex divisor(makeDigits(digits, '9'));
+    for (auto _ : state) {
+        auto qr = dividend.divmod(divisor);
+        benchmark::DoNotOptimize(qr);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DivMod)->Arg(256)->Arg(1024)->Arg(4096);
+
+template <bool oddModulus>
+static void BM_PowMod(benchmark::State& state) {
+    const size_t digits = state.range(0) / 4;
+    const Hex base(makeDigits(digits, 'A'));
+    const Hex exponent(makeDigits(digits, '5'));
+    std::string modulusDigits = makeDigits(digits, 'D');
+    modulusDigits.back() = oddModulus ? 'D' : 'C';
+    const Hex modulus(modulusDigits);
+    for (auto _ : state) {
+        Hex result = base.powmod(exponent, modulus);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_PowMod, true)->Arg(256)->Arg(1024)->Arg(4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_PowMod, false)->Arg(256)->Arg(1024)->Arg(4096)->Unit(benchmark::kMicrosecond);
@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <unordered_map>
 #include "../include/Hex.h"
+#include "../include/HexFile.h"
+#include "../include/HexN.h"
 
 TEST(HexTest, DefaultConstructor) {
     Hex hex;
@@ -95,6 +101,661 @@ TEST(HexTest, AssignOperations) {
     EXPECT_EQ(result2.toString(), "B");
 }
 
+TEST(HexTest, GetDigits) {
+    Hex hex("1A3F");
+    std::vector<unsigned char> digits = hex.getDigits();
+    ASSERT_EQ(hex.getSize(), 4);
+    EXPECT_EQ(digits[0], 0xF);
+    EXPECT_EQ(digits[1], 0x3);
+    EXPECT_EQ(digits[2], 0xA);
+    EXPECT_EQ(digits[3], 0x1);
+}
+
+TEST(HexTest, MultiLimbCarryAndBorrow) {
+    Hex a(std::string(40, 'F'));
+    Hex one("1");
+    Hex sum = a.add(one);
+    EXPECT_EQ(sum.toString(), "1" + std::string(40, '0'));
+    EXPECT_EQ(sum.getSize(), 41);
+    EXPECT_EQ(sum.subtract(one).toString(), std::string(40, 'F'));
+
+    Hex b("123456789ABCDEF0123456789ABCDEF1");
+    Hex c("FEDCBA9876543210FEDCBA9876543210");
+    EXPECT_EQ(b.add(c).toString(), "111111111111111011111111111111101");
+    EXPECT_EQ(c.subtract(b).toString(), "ECA8641FDB975320ECA8641FDB97531F");
+    EXPECT_TRUE(c.greaterThan(b));
+    EXPECT_TRUE(b.lessThan(c));
+}
+
+TEST(HexTest, InlineAndHeapStorage) {
+    // 32 цифры помещаются во встроенный буфер, 33 и более - в кучу
+    for (size_t digits : {1, 16, 32, 33, 100}) {
+        Hex original(std::string(digits, 'C'));
+        Hex copy(original);
+        EXPECT_TRUE(copy.equals(original));
+
+        Hex moved(std::move(copy));
+        EXPECT_EQ(moved.toString(), std::string(digits, 'C'));
+        EXPECT_EQ(copy.getSize(), 0);
+        EXPECT_EQ(copy.toString(), "0");
+    }
+}
+
+TEST(HexTest, NormalizeAfterShrink) {
+    Hex big("1" + std::string(40, '0'));
+    Hex almost("F" + std::string(39, '0'));
+    Hex diff = big.subtract(almost);
+    EXPECT_EQ(diff.toString(), "1" + std::string(39, '0'));
+    EXPECT_EQ(diff.getSize(), 40);
+
+    Hex zero = big.subtract(big);
+    EXPECT_EQ(zero.getSize(), 1);
+    EXPECT_EQ(zero.toString(), "0");
+}
+
+TEST(HexTest, CompoundAssignmentInPlace) {
+    Hex acc("FFFFFFFFFFFFFFFF");
+    Hex one("1");
+    acc += one;
+    EXPECT_EQ(acc.toString(), "10000000000000000");
+
+    acc -= one;
+    EXPECT_EQ(acc.toString(), "FFFFFFFFFFFFFFFF");
+
+    acc += acc;
+    EXPECT_EQ(acc.toString(), "1FFFFFFFFFFFFFFFE");
+
+    // Результат может стать отрицательным
+    Hex big(std::string(40, 'F'));
+    acc -= big;
+    EXPECT_EQ(acc.toString(), "-FFFFFFFFFFFFFFFFFFFFFFFE0000000000000001");
+    acc += big;
+    EXPECT_EQ(acc.toString(), "1FFFFFFFFFFFFFFFE");
+
+    big -= big;
+    EXPECT_EQ(big.toString(), "0");
+}
+
+TEST(HexTest, MovedFromIsUsable) {
+    // Встроенный буфер и память кучи, конструктор и присваивание перемещением
+    Hex small("-123");
+    Hex big(std::string(40, 'A'));
+    Hex target;
+    Hex fromSmall(std::move(small));
+    target = std::move(big);
+    EXPECT_EQ(fromSmall.toString(), "-123");
+    EXPECT_EQ(target.toString(), std::string(40, 'A'));
+
+    for (Hex* moved : {&small, &big}) {
+        EXPECT_EQ(moved->getSize(), 0);
+        EXPECT_EQ(moved->toString(), "0");
+        EXPECT_EQ(moved->add(Hex("FF")).toString(), "FF");
+        EXPECT_EQ(moved->add(*moved).toString(), "0");
+        EXPECT_EQ(Hex("FF").subtract(*moved).toString(), "FF");
+        EXPECT_EQ(moved->subtractSigned(Hex("1")).toString(), "-1");
+        Hex chained = *moved + fromSmall - *moved;
+        EXPECT_EQ(chained.toString(), "-123");
+
+        Hex acc("10");
+        acc += *moved;
+        EXPECT_EQ(acc.toString(), "10");
+        acc -= *moved;
+        EXPECT_EQ(acc.toString(), "10");
+
+        std::vector<unsigned char> buffer(moved->binarySize());
+        EXPECT_EQ(moved->toBinary(buffer.data()), buffer.data() + buffer.size());
+        EXPECT_EQ(buffer.size(), Hex().binarySize());
+    }
+
+    // Перемещённый объект можно использовать как накопитель и присвоить заново
+    small += Hex("-5");
+    EXPECT_EQ(small.toString(), "-5");
+    big = Hex("7");
+    EXPECT_EQ(big.toString(), "7");
+}
+
+TEST(HexTest, AccumulatorMatchesAdd) {
+    Hex acc;
+    Hex expected;
+    Hex step("FEDCBA9876543210");
+    for (int i = 0; i < 1000; ++i) {
+        acc += step;
+        expected = expected.add(step);
+    }
+    EXPECT_TRUE(acc.equals(expected));
+    EXPECT_EQ(acc.toString(), "3E38E38E38E38E38E80");
+
+    for (int i = 0; i < 1000; ++i) {
+        acc -= step;
+    }
+    EXPECT_EQ(acc.toString(), "0");
+}
+
+TEST(HexTest, Assignment) {
+    Hex small("AB");
+    Hex large(std::string(50, '9'));
+
+    Hex target;
+    target = large;
+    EXPECT_TRUE(target.equals(large));
+    target = small;
+    EXPECT_EQ(target.toString(), "AB");
+
+    target = std::move(large);
+    EXPECT_EQ(target.toString(), std::string(50, '9'));
+    EXPECT_EQ(large.getSize(), 0);
+}
+
+TEST(HexTest, Multiplication) {
+    EXPECT_EQ(Hex("0").multiply(Hex("ABC")).toString(), "0");
+    EXPECT_EQ(Hex("1").multiply(Hex("ABC")).toString(), "ABC");
+    EXPECT_EQ(Hex("FF").multiply(Hex("FF")).toString(), "FE01");
+    EXPECT_EQ(Hex("FFFFFFFFFFFFFFFF").multiply(Hex("FFFFFFFFFFFFFFFF")).toString(),
+              "FFFFFFFFFFFFFFFE0000000000000001");
+    EXPECT_EQ(Hex("123456789ABCDEF0123").multiply(Hex("FEDCBA987654321")).toString(),
+              "121FA00AD77D74223588D7800B00EA4E83");
+}
+
+TEST(HexTest, KaratsubaMatchesSchoolbook) {
+    const Hex a("8EAC492091F271F47E49E18692E295990881BA9BE85A74CDA9C49436D6F6DC3D716BF22FF5FD25F0F21231A06A7CB3AA75AB7D1944FF09974B85F2306D4A8A2AD16E107AC8069B51C6322463278ECEF2D30194DF943C353A0106E6C08269844DBC0CA65423A9E744B24E7F61701E1607B1C4B0F913063C02E56756A3E9570EDCA4ECA92D04A31B941F4360908405D45C39A39EC353C162E917D310269470D0718C1AFDD9A78D18DFF3934223AA56A9B7E3EA1D1D784FB9DB434B610B1631E941AA79E6EDAF80796D3BC4685CA8AF852A5FBA444ADF42B37F5722051E2670C24F6AA83BF36A147C2F7AD016EDC5D467164890D49D0AC1E5B8063831360A4092B850AD7EB72F8263F65DA874007CB47CC661E97589CA4A07C15471A4517D6C6694F229359B154881A0D5B3FFC6E35CCFAF00103F584AD4230824D215CEB3A10B3510B0B46EE1DA317017A6205738D16018366CF658F7A75ED34FE53A096533");
+    const Hex b("65A84E090A2CDD3FBE6ABB3E13E4373A7DB494D2A8D595BF234C60DED1607E39D14138CAD26C64107F089D8567444FC6F938443E4F57DE014C4BB36EC8030CF05DE86C68CD3E6F54D4581DA689384EF90A8B80EB31B3880DE0E9BE9F8881E6187FDB522231E7397785CEE116191248A2A4A834D5808281A6BF48CB74A9875A34F25B11B76F2670E0984F0CF267329911DA9FBD873580ED55037EA03260D7EF27BBA4D70DFCF3332EB05B6659EAB3BFCD5D50545214B0AFB81E8824918818FD64F799EF936AC3A8DB5628865529228DC5196D16328FE0C99F3EDAE3DF9C5B507A36");
+    const std::string expected = "38A7C5675EF6A87357778BA14B9B4502E0A30CC82CB6D11C1F600F774E1111D5EA001F90730B36E090E6D0C67AB2BBA44956A132AD76DD583E8CCDA0548BB4B1807C92882899C97EE2BF1DA5FC6DCE70D9A3747D97DCB98DB406E51BE28201CA538D5028D2394F5C7BADAE7646E4701A5C92E566BC2BDD4ABEA771AC825435931274BC46EA589751645579589C2BEF908D85A83C9F71EBD8CB47C84E70C8D37AAF6E78F28A651D80645A53A7CADE329B7B12A22B6E2579C5FCEB26400F5637B7FDD9B758AF5B6E22EEB906ACCD055B7FFF8A8A96A9F48EAFC027EDFC3008C369D68C3BA86E894931D5FD42EE3D762F391702F48B8677C6E34F989C9A508CEA0159D54E0FF6E9FC0C8C6154D07E3DB5B2996E0ABA2977DA53C0C768E5CD51D08738EA0493138EDDF2D92277FEA12972A255973DA62B5F0D94AE8707485783B7C0D0EDC327C4655C626EDA1F75807E7B6A85D9910CD742BCFF38283A1B7A49145E3E2AA68715CC11F37A7E24E06323F7F4142BB5B8782EA435E968373218CEA5E685EC72A71463AC40A14BD58E457F31D035B67220E47897FF3CD99A7D5043ACB11B2A3C94B3CE5814C707D6431C4E40613EB41152035D65E47FDC4061FCD1D6868F6AC4C3E8F7B038A2AF8A60A4B4A8ADEB4A7498D4047E5D3FED2E27C45A5320DAFE3FBD6D4AFD84B6F1E15F307936BE01401B6C113A2C6485695AD2F4BD70B4C49E6CC05E1575549BA77C9C898F2A4132C79F8ECD2F6C24E57246C263656E3D2741C37A7FD1683EEFEEFC334F7C2778B9C1332004C307DF03A9FF7925A6C2";
+
+    size_t saved = Hex::karatsubaThreshold;
+    for (size_t threshold : {size_t(4), size_t(5), size_t(8), size_t(1000)}) {
+        Hex::karatsubaThreshold = threshold;
+        EXPECT_EQ(a.multiply(b).toString(), expected) << threshold;
+        EXPECT_EQ(b.multiply(a).toString(), expected) << threshold;
+        EXPECT_TRUE(a.multiply(a).equals(Hex("4F8395127A90AB9571722150A8E815FFC617EDD4EB1A19EF4E09387F03546154F3C7BB353DD8F9BE23FB9B46D39E11401F2ABE1E8D2F818F41EEF4978ABBAFBBB3F87EEA6AB36C76F2C2CEB53A1F0E5753B2BFDAD90FB10B054CBCA5DBADF90A72270E6F66116D844725C03EBC3663B06E3E47D552257F707A4C1A54151B2EFB3EE2700AC5ABAF97B162A9CB21ABBC9F7D32159373BA987CE64C63B94BD188C1C550B2D945CDAEE05AA180653812BDDCDD5C60ECAAE8136C71954736B3E38372AF6A47644BE08DDA6362ADFF2EF7A691D637A0CFEA17822D8EA744FF7F5CADAC9A823377FB7A0CF8D7016C7847B57C2E4A570204E5B52E769732F310F35CE5A6CEDF9860DFE92AFCF75E4EA3F95F1335E3648A634C3B5E49FE7B19B7F440018398346BA623EDF9399C374FDF94552FFE1E9673AC9561658713CE4DA3DD42B74E4D88284C6CCA96D6539B90C773E534DA2B71938356F0B3D0C2D17B3D401D9C8CCDC3779014176061950BBD158B453E1D9CDBAFD8A91CEA70A48413C21D7CD34E4CF2DC1CEACF80131535A9F894DB6AF4DE94E5B80C3E0C2C578BADE13770094ADE17F3A31D82C6937981D6285CAC9BBB5D6F5E5B2AF165AC28C651AAB4980637BF803487ED9E1A7E4F4B0918681C75A3EADB6BB01C661693717DEE0E6CE1ED197F72B55057F5525C92328CEB09B5530861322FB8988238F0AE20CDD90221DD5EF1033F37975CBF95088516939B542408C51E0116D76279E16D503AFE9D903E27EBBB71A949AA6E88132AC30C97B0AB40EEBCD5090CE33253757E7669161886CABAA8A0C7E36BBFD976E1BFBECA8DFEB4A1EAAB7B6F99514BE921115F8F270D1B7442A421EB98CDDCEB3806C3F67E117C11EE16A69D385B09BA898748EA9C7FB90322EFED77B8A3324313F353C9D604EA396E2EB79820DD4D69AA027053511FB1F4C120A03265E12553AD4E10404F4C2494064B6AF47EC97161974829"))) << threshold;
+    }
+    Hex::karatsubaThreshold = saved;
+}
+
+TEST(HexTest, DivisionAndModulo) {
+    auto [q, r] = Hex("64").divmod(Hex("7"));
+    EXPECT_EQ(q.toString(), "E");
+    EXPECT_EQ(r.toString(), "2");
+
+    auto [q2, r2] = Hex("5").divmod(Hex("FF"));
+    EXPECT_EQ(q2.toString(), "0");
+    EXPECT_EQ(r2.toString(), "5");
+
+    const Hex a("BF00188CA22E4C76237DBE6B03DA701C632976A10363C5F972651DAFDB119A9EC801BDFDF2965B3819AD93B21E6A46F1C670EA90D243A163CEE5E2C2B1E1885283B73A66C2EA417B99DE255F386825473B7A490F23B2CC4B4174A672B5EBAA061076DC3BA6ACE6C0A78250FB339A4769DDCC6F8EFB6FBFE8DE4AB47558298E214B044D79ACD8ACDE5F6DB1D76B6745180B65386569C803601A5BA50AD38835EDDD6FF552FA73207237751AA4462EBFC5F915EF09CFBAC6E7687A66E");
+    const Hex b("33115510B0ECF26CF3C17E55777039E47FBB3B46583D61435BB5C11E95027004448A6A1C5C7D1861674518DE3BB41B36BF82959CB01C357B9C7E435396BCB8FAC9ABB0C3478442B4A8AA593EB40A9B81A070205E323BB2A");
+    auto [q3, r3] = a.divmod(b);
+    EXPECT_EQ(q3.toString(), "3BD79D4589DDD9A87F74B03D598CDCDF287ADF1349760AE7D4EEFA6B1F41926C77F9CE1B5B4795285FA8FE079EDC324DBE5BB40B90B6DC3B0E2116541D113A6C1991699353A7FCAA0A65E470182DE38B032180C770046EF6C829E3ACEE2E9E37F98AD9DFE");
+    EXPECT_EQ(r3.toString(), "1E4F27F2934888A15DA8EFFF8A5DCC517EBC708E34DCC0A435D1BBCA9A1312984F7E9C00DC94B681789A6C78521AB32E6348C294267C078DF1B43EA3291FF355998149510CC99186227C3E36B3AB27FD608402DC3E930C2");
+    EXPECT_TRUE(q3.multiply(b).add(r3).equals(a));
+    EXPECT_TRUE(a.mod(b).equals(r3));
+
+    EXPECT_THROW(a.divmod(Hex("0")), std::invalid_argument);
+}
+
+TEST(HexTest, ModularExponentiation) {
+    EXPECT_EQ(Hex("3").powmod(Hex("4"), Hex("7")).toString(), "4");     // 81 mod 7
+    EXPECT_EQ(Hex("2").powmod(Hex("0"), Hex("D")).toString(), "1");
+    EXPECT_EQ(Hex("2").powmod(Hex("10"), Hex("1")).toString(), "0");
+
+    // Нечётный 1024-битный модуль - путь Монтгомери, чётный - общий путь
+    const Hex base("BEC2638D17FDA1BDDC69B3BC5EFAEE7D5168E187590451E5C330DDE4B940A8C16A8F554D8C2B83A04209BE01B4FF09131582C2C93AB25362104946DC860B36AC08417EA3A98C3D0560DA382FE103131B13D65EC29F8119E333A6B8C290D32BBA064EBC1D3D2899F57F77F2A75EC92AEB20C15B7D95F8034A6A704789365EAEB999B8A2E547E22184E82");
+    const Hex exponent("E1B7A662DD3177811C26B9C058E1FA75DE0C057F163488CBB00E0067C64DD2E190B301FF971B377685A5A77AAC937076D87D8E185DAEB168BC6A37110B0410008141DF319C72D92C2967C63D3C9E0381E7F8EC98F36FACE167019017B4999178DE6081741F0FD9E908C3D505FF7A96319345A915FEB0B634BCA4537F44B00011");
+    EXPECT_EQ(base.powmod(exponent, Hex("95607DF9E4794195021CD6FF548914EF33FB4B4FDA298ADEE5329B4E329A86139425B3E2C3AD4D991F0916CB00FDED6598CAE043F6C986F21CAF107AD9C98C23E80A86CFBC79CE036CBACCF13C9A8DF50602FE0C239EDD3A7DE0D208D886C5D060FA1C95E553FB510E06ACD4694398C5E11E99FB01597AC1E2EB17C8B573F6C5")).toString(), "39520191B26ED4D552E4DA86271B11860C9F5173E9DD25B3D57F576255F37FA4AB6547F63B37F202B2BB06941FA4FBE1A7C2D03323355E6B3E8AADC945EE9ABDA48F3986BAF270557E77F6371C58B8A56EF792FD4032A9205DD6FD6BCE0358AF7AEC3CC693FCE9DAEB77FAA0EE21AEC0A232BF81A12B98B6CF317372E2A28A5A");
+    EXPECT_EQ(base.powmod(exponent, Hex("805099F4A84CF59D372A95C999470154C204FA9A096759757DCC4CE3261C7733E4D08075F8DE627C65C5777ACDE9442A6B8921F4E710CB5ABB2BC7D72B146020")).toString(), "1042BD484EAF077B8E02B48E86F2105E89E20ACF923603D3E2240DBC5266EF9BEAB66B08B53C8F4C7E55E8D23049A0847C49941BEE3E1E920DDB403D505ADC0");
+
+    EXPECT_THROW(base.powmod(exponent, Hex("0")), std::invalid_argument);
+}
+
+TEST(HexTest, StringRoundTripAllLengths) {
+    const std::string alphabet = "0123456789abcdefABCDEF";
+    for (size_t length = 1; length <= 100; ++length) {
+        std::string text;
+        for (size_t i = 0; i < length; ++i) {
+            text += alphabet[(i * 7 + length) % alphabet.size()];
+        }
+        text[0] = 'f';
+
+        std::string expected = text;
+        for (char& c : expected) c = static_cast<char>(std::toupper(c));
+
+        Hex hex(text);
+        EXPECT_EQ(hex.getSize(), length);
+        EXPECT_EQ(hex.toString(), expected);
+    }
+}
+
+TEST(HexTest, InvalidDigitAnyPosition) {
+    for (size_t length : {1, 15, 16, 17, 32, 33, 64, 70}) {
+        for (size_t pos = 0; pos < length; ++pos) {
+            std::string text(length, '5');
+            text[pos] = (pos % 2) ? 'g' : ' ';
+            EXPECT_THROW(Hex{text}, std::invalid_argument) << length << " " << pos;
+        }
+    }
+}
+
+TEST(HexTest, StringViewAndToChars) {
+    std::string_view view = "xx00ABCDEF0123456789ABCDEFyy";
+    Hex hex(view.substr(2, 24));
+    EXPECT_EQ(hex.toString(), "ABCDEF0123456789ABCDEF");
+
+    char buffer[32];
+    char* end = hex.toChars(buffer);
+    EXPECT_EQ(std::string(buffer, end), "ABCDEF0123456789ABCDEF");
+
+    Hex zero("000");
+    end = zero.toChars(buffer);
+    EXPECT_EQ(std::string(buffer, end), "0");
+}
+
+TEST(HexTest, ConstructorOverloads) {
+    // Целое число выбирает конструктор размера, а не строку или ресурс
+    static_assert(std::is_constructible_v<Hex, int>);
+    EXPECT_THROW(Hex(0), std::invalid_argument);
+    EXPECT_EQ(Hex(2, 7).toString(), "77");
+
+    // Все виды строк разбираются одинаково, в том числе с ресурсом
+    std::string str = "-1F";
+    const char* cstr = str.c_str();
+    Hex fromString = str;
+    EXPECT_EQ(fromString.toString(), "-1F");
+    EXPECT_EQ(Hex(cstr).toString(), "-1F");
+    EXPECT_EQ(Hex(std::string_view(str)).toString(), "-1F");
+
+    std::pmr::monotonic_buffer_resource pool;
+    Hex inPool(str, &pool);
+    EXPECT_EQ(inPool.toString(), "-1F");
+    EXPECT_EQ(inPool.getResource(), &pool);
+    Hex zeroInPool(&pool);
+    EXPECT_EQ(zeroInPool.toString(), "0");
+    EXPECT_EQ(zeroInPool.getResource(), &pool);
+}
+
+TEST(HexTest, ExpressionTemplateChain) {
+    Hex a("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+    Hex b("1");
+    Hex c("10");
+    Hex d("F");
+
+    Hex result = a + b + c - d;
+    EXPECT_EQ(result.toString(), "100000000000000000000000000000001");
+    EXPECT_EQ(result.toString(), a.add(b).add(c).subtract(d).toString());
+
+    // Группировка справа: a - (c - d) = a - c + d
+    Hex grouped = a - (c - d);
+    EXPECT_EQ(grouped.toString(), "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE");
+
+    // Перенос через несколько слов и сокращение до одной цифры
+    Hex x("10000000000000000000000000000000000000000");
+    EXPECT_EQ(Hex(x - b + b).toString(), x.toString());
+    EXPECT_EQ(Hex(x - x + b).toString(), "1");
+    EXPECT_EQ(Hex(x - b).toString(), "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+}
+
+TEST(HexTest, ExpressionTemplateAliasing) {
+    Hex a("123456789ABCDEF0123456789ABCDEF");
+    Hex b("FEDCBA9876543210FEDCBA987654321");
+    Hex c("1");
+
+    Hex expected = a.add(b).subtract(c);
+    a = a + b - c;
+    EXPECT_EQ(a.toString(), expected.toString());
+
+    a = a + a + a;
+    EXPECT_EQ(a.toString(), expected.add(expected).add(expected).toString());
+}
+
+TEST(HexTest, ExpressionTemplateNegativeResult) {
+    Hex a("5");
+    Hex b("6");
+    Hex target("ABC");
+    target = a - b;
+    EXPECT_EQ(target.toString(), "-1");
+    EXPECT_EQ(Hex(a + a - b - b).toString(), "-2");
+
+    // Знак значения умножается на знак в выражении
+    Hex minusA("-5");
+    EXPECT_EQ(Hex(b - minusA).toString(), "B");
+    EXPECT_EQ(Hex(minusA + a).toString(), "0");
+    EXPECT_FALSE(Hex(minusA + a).isNegative());
+
+    // Модуль отрицательной суммы шире всех слагаемых: -F..F - F..F = -1F..FE
+    Hex full(std::string(32, 'F'));
+    Hex zero("0");
+    EXPECT_EQ(Hex(zero - full - full).toString(), "-1" + std::string(31, 'F') + "E");
+    EXPECT_EQ(Hex(zero - full - b + b).toString(), "-" + std::string(32, 'F'));
+    Hex limb("10000000000000000");
+    EXPECT_EQ(Hex(zero - limb - limb - limb).toString(), "-30000000000000000");
+}
+
+TEST(HexTest, SumMatchesSequentialAdd) {
+    EXPECT_EQ(Hex::sum({}).toString(), "0");
+
+    std::vector<Hex> small = {Hex("FFFFFFFFFFFFFFFF"), Hex("1"), Hex("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF")};
+    EXPECT_EQ(Hex::sum(small).toString(), "10000000000000000FFFFFFFFFFFFFFFF");
+
+    // Достаточно значений, чтобы сумма считалась в нескольких потоках; длины от 1 до 80 цифр
+    const std::string alphabet = "0123456789ABCDEF";
+    std::vector<Hex> values;
+    for (size_t k = 0; k < 200000; ++k) {
+        std::string text(k % 80 + 1, 'F');
+        for (size_t i = 0; i < text.size(); i += 3) text[i] = alphabet[(k * 7 + i) % 16];
+        values.emplace_back(text);
+    }
+
+    Hex expected;
+    for (const Hex& value : values) expected = expected.add(value);
+    EXPECT_EQ(Hex::sum(values).toString(), expected.toString());
+
+    // Разбиение на заданное число частей (в том числе неравных) не зависит от числа ядер
+    for (size_t threads : {2, 3, 7}) {
+        EXPECT_TRUE(Hex::sum(values, threads).equals(expected)) << threads << " threads";
+    }
+
+    // Со знаками: частичные суммы потоков могут быть разных знаков
+    std::vector<Hex> mixed;
+    Hex mixedExpected;
+    for (size_t k = 0; k < 1000; ++k) {
+        mixed.push_back(k % 3 == 0 ? -values[k * 37] : values[k * 37]);
+        mixedExpected += mixed.back();
+    }
+    for (size_t threads : {2, 3, 7, 5000}) {
+        EXPECT_TRUE(Hex::sum(mixed, threads).equals(mixedExpected)) << threads << " threads";
+    }
+}
+
+TEST(HexTest, ThreeWayComparison) {
+    Hex small("FFFFFFFFFFFFFFFF");
+    Hex large("10000000000000000");
+    Hex sameHigh("20000000000000001");
+    Hex sameHighLess("20000000000000000");
+
+    EXPECT_TRUE(small < large);
+    EXPECT_TRUE(large > small);
+    EXPECT_TRUE(sameHighLess < sameHigh);
+    EXPECT_EQ(sameHigh <=> sameHigh.copy(), std::strong_ordering::equal);
+    EXPECT_EQ(large <=> small, std::strong_ordering::greater);
+    EXPECT_TRUE(Hex("00ABC") == Hex("ABC"));
+    EXPECT_TRUE(Hex("ABC") != Hex("ABD"));
+    EXPECT_TRUE(Hex("0") <= Hex("000"));
+}
+
+TEST(HexTest, HashAsMapKey) {
+    // Равные значения, полученные разными путями, дают равный хеш
+    Hex parsed("10000000000000000");
+    Hex computed = Hex("FFFFFFFFFFFFFFFF").add(Hex("1"));
+    EXPECT_EQ(std::hash<Hex>{}(parsed), std::hash<Hex>{}(computed));
+    EXPECT_EQ(std::hash<Hex>{}(Hex("0")), std::hash<Hex>{}(Hex("5").subtract(Hex("5"))));
+
+    std::unordered_map<Hex, int> counts;
+    std::set<Hex> ordered;
+    for (int k = 0; k < 1000; ++k) {
+        Hex key(std::to_string(k % 100));
+        ++counts[key];
+        ordered.insert(key);
+    }
+    EXPECT_EQ(counts.size(), 100u);
+    EXPECT_EQ(counts[Hex("42")], 10);
+    EXPECT_EQ(ordered.begin()->toString(), "0");
+    EXPECT_EQ(ordered.rbegin()->toString(), "99");
+}
+
+TEST(HexTest, CompileTimeLiterals) {
+    constexpr auto word = 0xDEAD'BEEF_hex;
+    static_assert(std::is_same_v<decltype(word), const HexN<64>>);
+    static_assert(word.limb(0) == 0xDEADBEEF);
+
+    constexpr auto wide = "1FFFFFFFFFFFFFFFF"_hex;
+    static_assert(std::is_same_v<decltype(wide), const HexN<128>>);
+    static_assert(wide.limb(1) == 1 && wide.limb(0) == ~0ull);
+
+    // constexpr-арифметика с переполнением по модулю 2^Bits
+    constexpr auto sum = wide + HexN<128>(1);
+    static_assert(sum.limb(1) == 2 && sum.limb(0) == 0);
+    static_assert((HexN<128>() - HexN<128>(1)).limb(1) == ~0ull);
+    static_assert(HexN<128>("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF") + HexN<128>(1) == HexN<128>());
+    static_assert(wide > HexN<128>(~0ull) && HexN<128>(5) < wide);
+    static_assert("00000000000000000000ff"_hex == HexN<128>(0xFF));
+
+    EXPECT_EQ((0xabcdef_hex).limb(0), 0xABCDEFu);
+    EXPECT_THROW(HexN<64>("12345678901234567"), std::invalid_argument);
+    EXPECT_THROW(HexN<64>("12G"), std::invalid_argument);
+    EXPECT_THROW(HexN<64>(""), std::invalid_argument);
+    EXPECT_EQ(HexN<64>("0000000000000000000000FF").limb(0), 0xFFu);
+}
+
+TEST(HexTest, FixedWidthConversions) {
+    Hex wide("123456789ABCDEF0FEDCBA9876543210ABC");
+    Hex256 fixed(wide);
+    EXPECT_EQ(fixed.toString(), "123456789ABCDEF0FEDCBA9876543210ABC");
+    EXPECT_TRUE(fixed.toHex().equals(wide));
+    EXPECT_EQ(Hex256().toString(), "0");
+    EXPECT_EQ(Hex256().toHex().toString(), "0");
+    EXPECT_THROW(Hex128{wide}, std::invalid_argument);
+
+    // Результаты HexN совпадают с Hex, пока нет переполнения ширины
+    Hex512 a("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+    Hex512 b(Hex("1"));
+    EXPECT_EQ((a + b).toHex().toString(), Hex(a.toHex()).add(Hex("1")).toString());
+    EXPECT_EQ((a - b - a).toString(), std::string(128, 'F'));
+    static_assert(("FF"_hex).toString() == "FF");
+
+    EXPECT_EQ(Hex::fromWords(std::array<uint64_t, 3>{1, 0, 0}).toString(), "1");
+    EXPECT_EQ(Hex::fromWords({}).toString(), "0");
+}
+
+TEST(HexTest, BinaryFileRoundTrip) {
+    std::vector<Hex> values = {Hex("0"), Hex("1"), Hex("FFFFFFFFFFFFFFFF"), Hex("10000000000000000"),
+                               Hex(std::string(100, 'A'))};
+    EXPECT_EQ(values[0].binarySize(), 16u);
+    EXPECT_EQ(values[3].binarySize(), 24u);
+
+    const std::string path = testing::TempDir() + "hex_values.bin";
+    writeHexFile(path, values);
+    {
+        HexFileReader reader(path);
+        ASSERT_EQ(reader.size(), values.size());
+        size_t i = 0;
+        for (HexView view : reader) {
+            EXPECT_EQ(view.getSize(), values[i].getSize());
+            EXPECT_EQ(view.toString(), values[i].toString());
+            EXPECT_TRUE(view.toHex().equals(values[i]));
+            ++i;
+        }
+        EXPECT_EQ(i, values.size());
+    }
+
+    writeHexFile(path, {});
+    EXPECT_EQ(HexFileReader(path).size(), 0u);
+
+    // Префикс обещает больше слов, чем есть в файле
+    unsigned char record[32];
+    unsigned char* end = Hex(std::string(40, '1')).toBinary(record);
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(record), end - record - 8);
+    }
+    EXPECT_THROW(HexFileReader{path}, std::runtime_error);
+    EXPECT_THROW(HexFileReader{path + ".missing"}, std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(HexTest, MemoryResource) {
+    // Ресурс, считающий выделения поверх стандартного
+    struct CountingResource : std::pmr::memory_resource {
+        size_t allocations = 0;
+        size_t live = 0;
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            ++allocations;
+            ++live;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+            --live;
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    CountingResource counting;
+    const std::string digits(40, 'A');
+    {
+        Hex a(digits, &counting);
+        Hex b(digits);
+        EXPECT_EQ(a.getResource(), &counting);
+        EXPECT_EQ(b.getResource(), std::pmr::get_default_resource());
+        EXPECT_EQ(counting.allocations, 1u);
+
+        // Результат использует ресурс левого операнда
+        Hex sum = a.add(b);
+        EXPECT_EQ(sum.getResource(), &counting);
+        EXPECT_EQ(b.add(a).getResource(), std::pmr::get_default_resource());
+        EXPECT_EQ(a.multiply(b).getResource(), &counting);
+        EXPECT_EQ(a.divmod(Hex("3")).second.getResource(), &counting);
+        Hex chain = a + b - b;
+        EXPECT_EQ(chain.getResource(), &counting);
+        EXPECT_TRUE(chain.equals(a));
+
+        // Копия - в ресурсе по умолчанию, перемещение между ресурсами копирует слова
+        Hex copied(a);
+        EXPECT_EQ(copied.getResource(), std::pmr::get_default_resource());
+        b = std::move(sum);
+        EXPECT_EQ(b.getResource(), std::pmr::get_default_resource());
+        EXPECT_EQ(b.toString(), Hex(digits).add(Hex(digits)).toString());
+        Hex moved(std::move(a));
+        EXPECT_EQ(moved.getResource(), &counting);
+    }
+    EXPECT_EQ(counting.live, 0u);
+
+    // Все временные значения пакета - в монотонной арене
+    std::pmr::monotonic_buffer_resource arena;
+    Hex acc(digits, &arena);
+    for (int i = 0; i < 100; ++i) acc = acc.add(Hex(digits));
+    EXPECT_EQ(acc.getResource(), &arena);
+    EXPECT_EQ(acc.toString(), Hex(digits).multiply(Hex("65")).toString());
+}
+
+TEST(HexTest, SignedArithmetic) {
+    Hex a("29");
+    Hex b("F");
+    EXPECT_EQ(b.subtractSigned(a).toString(), "-1A");
+    EXPECT_EQ(a.subtractSigned(b).toString(), "1A");
+    EXPECT_THROW(b.subtract(a), std::invalid_argument);
+
+    Hex minus("-1A");
+    EXPECT_TRUE(minus.isNegative());
+    EXPECT_EQ(minus.getSize(), 2u);
+    EXPECT_EQ(minus.add(a).toString(), "F");
+    EXPECT_EQ(minus.add(b).toString(), "-B");
+    EXPECT_EQ(minus.subtractSigned(b).toString(), "-29");
+    EXPECT_EQ(minus.subtractSigned(minus).toString(), "0");
+    EXPECT_EQ(minus.multiply(minus).toString(), "2A4");
+    EXPECT_EQ(minus.multiply(b).toString(), "-186");
+    EXPECT_EQ((-minus).toString(), "1A");
+    EXPECT_EQ(Hex("-0").toString(), "0");
+    EXPECT_FALSE(Hex("-000").isNegative());
+    EXPECT_THROW(Hex("-"), std::invalid_argument);
+
+    // Перенос и заём через несколько слов
+    Hex wide("100000000000000000000000000000000");
+    Hex one("1");
+    EXPECT_EQ(one.subtractSigned(wide).toString(), "-" + std::string(32, 'F'));
+    EXPECT_EQ(Hex("-1").add(wide).toString(), std::string(32, 'F'));
+    EXPECT_EQ(Hex("-1").subtractSigned(wide).toString(), "-100000000000000000000000000000001");
+
+    // Деление с отбрасыванием дробной части: остаток со знаком делимого
+    auto [q, r] = Hex("-64").divmod(Hex("7")); // -100 = -14 * 7 - 2
+    EXPECT_EQ(q.toString(), "-E");
+    EXPECT_EQ(r.toString(), "-2");
+    EXPECT_EQ(Hex("-2").powmod(Hex("3"), Hex("7")).toString(), "6"); // -8 mod 7
+    EXPECT_THROW(Hex("2").powmod(Hex("-3"), Hex("7")), std::invalid_argument);
+    EXPECT_THROW(Hex("2").powmod(Hex("3"), Hex("-7")), std::invalid_argument);
+
+    char buffer[8];
+    EXPECT_EQ(std::string(buffer, minus.toChars(buffer)), "-1A");
+}
+
+TEST(HexTest, SignedComparisonAndHash) {
+    std::vector<Hex> values = {Hex("-100"), Hex("-F"), Hex("0"), Hex("F"), Hex("100")};
+    for (size_t i = 0; i < values.size(); ++i) {
+        for (size_t j = 0; j < values.size(); ++j) {
+            EXPECT_EQ(values[i] < values[j], i < j) << i << " " << j;
+            EXPECT_EQ(values[i] == values[j], i == j) << i << " " << j;
+        }
+    }
+    EXPECT_NE(std::hash<Hex>{}(Hex("F")), std::hash<Hex>{}(Hex("-F")));
+    EXPECT_EQ(std::hash<Hex>{}(Hex("-F")), std::hash<Hex>{}(Hex("-10").add(Hex("1"))));
+    EXPECT_THROW(Hex128{Hex("-1")}, std::invalid_argument);
+}
+
+TEST(HexTest, SignedSumAndSerialization) {
+    std::vector<Hex> values;
+    Hex expected;
+    for (int k = 0; k < 50000; ++k) {
+        std::string text(k % 40 + 1, "0123456789ABCDEF"[k % 16]);
+        if (k % 3 == 0) text.insert(0, "-");
+        values.emplace_back(text);
+        expected += values.back();
+    }
+    EXPECT_EQ(Hex::sum(values).toString(), expected.toString());
+
+    const std::string path = testing::TempDir() + "hex_signed.bin";
+    writeHexFile(path, values);
+    HexFileReader reader(path);
+    size_t i = 0;
+    for (HexView view : reader) {
+        EXPECT_EQ(view.isNegative(), values[i].isNegative());
+        EXPECT_TRUE(view.toHex().equals(values[i]));
+        ++i;
+    }
+    std::remove(path.c_str());
+}
+
+TEST(HexTest, BitShifts) {
+    Hex a("1ABC");
+    EXPECT_EQ(a.shiftLeft(4).toString(), "1ABC0");
+    EXPECT_EQ((a << 1).toString(), "3578");
+    EXPECT_EQ((a << 64).toString(), "1ABC0000000000000000");
+    EXPECT_EQ((a << 67).toString(), "D5E00000000000000000");
+    EXPECT_EQ((a >> 3).toString(), "357");
+    EXPECT_EQ((a >> 13).toString(), "0");
+    EXPECT_EQ((a >> 1000).toString(), "0");
+    EXPECT_EQ(a.shiftLeftDigits(20).toString(), "1ABC" + std::string(20, '0'));
+    EXPECT_EQ(a.shiftRightDigits(2).toString(), "1A");
+    EXPECT_EQ(a.shiftRightDigits(4).toString(), "0");
+
+    // Сдвиг через границы слов и обратно
+    Hex wide("123456789ABCDEF0FEDCBA9876543210F");
+    EXPECT_EQ((wide << 125 >> 125).toString(), wide.toString());
+    EXPECT_EQ((wide >> 68).toString(), "123456789ABCDEF0");
+
+    // Знак сохраняется, ноль неотрицательный
+    EXPECT_EQ((Hex("-F0") >> 4).toString(), "-F");
+    EXPECT_EQ((Hex("-F0") << 4).toString(), "-F00");
+    EXPECT_FALSE((Hex("-F") >> 4).isNegative());
+}
+
+TEST(HexTest, BitwiseOperations) {
+    Hex a("F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0");
+    Hex b("FF00FF");
+    EXPECT_EQ((a & b).toString(), "F000F0");
+    EXPECT_EQ((a | b).toString(), "F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0FFF0FF");
+    EXPECT_EQ((a ^ b).toString(), "F0F0F0F0F0F0F0F0F0F0F0F0F0F0F00FF00F");
+    EXPECT_EQ((b ^ a).toString(), (a ^ b).toString());
+    EXPECT_EQ((a ^ a).toString(), "0");
+    EXPECT_EQ(a.bitAnd(Hex("0")).toString(), "0");
+
+    // Операции над модулями: результат неотрицательный
+    EXPECT_EQ(Hex("-F").bitOr(Hex("10")).toString(), "1F");
+    EXPECT_FALSE(Hex("-F").bitAnd(Hex("-F")).isNegative());
+
+    EXPECT_EQ(a.popcount(), 72u);
+    EXPECT_EQ(Hex("0").popcount(), 0u);
+    EXPECT_EQ(Hex("-7").popcount(), 3u);
+    EXPECT_EQ(Hex(std::string(1000, 'F')).popcount(), 4000u);
+}
+
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
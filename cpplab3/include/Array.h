@@ -2,33 +2,131 @@
 #define ARRAY_H
 
 #include "Figure.h"
+#include "Pentagon.h"
+#include "Hexagon.h"
+#include "Octagon.h"
+#include <cstdint>
 #include <vector>
 #include <memory>
+#include <span>
 
+// Массив фигур. Фигуры каждого типа хранятся подряд в своём векторе (без отдельного
+// выделения памяти и счётчика ссылок на фигуру), порядок добавления - в списке слотов.
+// Слот (slot map) связывает устойчивый идентификатор Handle с положением фигуры, поэтому
+// добавление и удаление по Handle выполняются за O(1)
 class Array {
+public:
+    enum class FigureType : unsigned char { Pentagon, Hexagon, Octagon };
+    // Режим пересчёта площади: в одном потоке или с разбиением между потоками
+    enum class Execution : unsigned char { Sequential, Parallel };
+
+    // Устойчивый идентификатор фигуры: не меняется при добавлении и удалении других фигур.
+    // При удалении фигуры поколение слота увеличивается, и старый идентификатор становится
+    // недействительным, даже если слот занят новой фигурой
+    struct Handle {
+        uint32_t slot = UINT32_MAX;
+        uint32_t generation = 0;
+
+        bool operator==(const Handle& other) const = default;
+    };
+
 private:
-    std::vector<std::shared_ptr<Figure>> figures;
-    
+    static constexpr uint32_t kNoSlot = UINT32_MAX;
+
+    // Слот фигуры. У свободного слота index - следующий свободный слот (kNoSlot - конец списка)
+    struct Slot {
+        uint32_t generation = 0;
+        FigureType type = FigureType::Pentagon;
+        size_t index = 0;    // Индекс в векторах типа
+        size_t position = 0; // Индекс в order
+    };
+
+    // Фигуры одного типа подряд; длины сторон и слоты фигур - в параллельных векторах
+    template <class T>
+    struct TypeStorage {
+        std::vector<T> figures;
+        std::vector<double> sides;
+        std::vector<uint32_t> slots;
+    };
+
+    TypeStorage<Pentagon> pentagons;
+    TypeStorage<Hexagon> hexagons;
+    TypeStorage<Octagon> octagons;
+    std::vector<Slot> slots;
+    std::vector<uint32_t> order; // Слоты фигур в порядке добавления
+    uint32_t freeSlot = kNoSlot; // Начало списка свободных слотов
+
+    // Текущая сумма площадей, обновляемая при добавлении и удалении (суммирование Ноймайера:
+    // погрешность от многих добавлений и удалений накапливается в компенсации)
+    double areaSum = 0.0;
+    double areaCompensation = 0.0;
+    void accumulateArea(double area);
+
+    const Figure& figureAt(uint32_t slot) const;
+    size_t positionOf(Handle handle) const; // Недействительный идентификатор - исключение
+    template <class T>
+    Handle insert(TypeStorage<T>& storage, FigureType type, T&& figure);
+    // Удаление из вектора типа: на место удалённой переносится последняя фигура этого типа
+    template <class T>
+    void eraseFrom(TypeStorage<T>& storage, size_t index);
+    void releaseSlot(uint32_t slot); // Удаление фигуры слота (order уже обновлён)
+
 public:
-    // Добавление фигуры
-    void addFigure(std::shared_ptr<Figure> figure);
-    
-    // Удаление фигуры по индексу
+    // Добавление фигуры (в массив записывается копия); возвращает идентификатор фигуры.
+    // Если фигура не Pentagon, Hexagon или Octagon (или nullptr) - исключение
+    Handle addFigure(std::shared_ptr<Figure> figure);
+    Handle addFigure(Pentagon figure);
+    Handle addFigure(Hexagon figure);
+    Handle addFigure(Octagon figure);
+
+    // Удаление фигуры по индексу (порядок остальных фигур сохраняется, O(n))
     void removeFigure(size_t index);
-    
-    // Общая площадь всех фигур
+    // Удаление за O(1): на место удалённой фигуры переносится последняя
+    void removeFigureUnordered(size_t index);
+    // Удаление по идентификатору за O(1) (как removeFigureUnordered);
+    // false, если идентификатор недействителен
+    bool removeFigure(Handle handle);
+
+    // Общая площадь всех фигур (без обхода массива)
     double totalArea() const;
-    
+
+    // Пересчёт общей площади по всем фигурам: для каждого типа площадь - kAreaFactor,
+    // умноженный на сумму квадратов длин сторон
+    double computeTotalArea(Execution execution = Execution::Sequential) const;
+
+    // Сумма квадратов значений: векторное ядро (AVX2 или SSE2), при Parallel большие
+    // массивы делятся между потоками
+    static double sumSquares(std::span<const double> values, Execution execution = Execution::Sequential);
+    // Сумма квадратов, разделённая ровно на threads частей (не больше числа значений;
+    // 0 или 1 - без потоков)
+    static double sumSquares(std::span<const double> values, size_t threads);
+
     // Вывод информации о всех фигурах
     void printAll() const;
-    
+
     // Размер массива
     size_t size() const;
-    
-    // Получение фигуры по индексу
+
+    // Получение копии фигуры по индексу (nullptr, если индекс вне диапазона)
     std::shared_ptr<Figure> getFigure(size_t index) const;
-    
-    // Очистка массива
+
+    // Фигура по индексу без копирования (индекс вне диапазона - исключение)
+    const Figure& operator[](size_t index) const;
+    FigureType getType(size_t index) const;
+
+    // Идентификаторы: проверка, фигура, индекс и идентификатор фигуры по индексу
+    // (недействительный идентификатор или индекс вне диапазона - исключение)
+    bool contains(Handle handle) const;
+    const Figure& operator[](Handle handle) const;
+    size_t getIndex(Handle handle) const;
+    Handle getHandle(size_t index) const;
+
+    // Фигуры одного типа, хранящиеся подряд
+    const std::vector<Pentagon>& getPentagons() const { return pentagons.figures; }
+    const std::vector<Hexagon>& getHexagons() const { return hexagons.figures; }
+    const std::vector<Octagon>& getOctagons() const { return octagons.figures; }
+
+    // Очистка массива (все идентификаторы становятся недействительными)
     void clear();
 };
 
@@ -3,16 +3,57 @@
 
 #include <iostream>
 #include <vector>
+#include <array>
 #include <cmath>
+#include <utility>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
+// sin и cos для вычислений во время компиляции (std::sin и std::cos не constexpr):
+// угол приводится к [-pi, pi], затем ряд Тейлора до сходимости
+constexpr std::pair<double, double> constexprSinCos(double angle) {
+    while (angle > M_PI) angle -= 2 * M_PI;
+    while (angle < -M_PI) angle += 2 * M_PI;
+    double sin = 0, cos = 0;
+    double term = 1; // angle^k / k!
+    for (int k = 0; k < 40; ++k) {
+        switch (k % 4) {
+            case 0: cos += term; break;
+            case 1: sin += term; break;
+            case 2: cos -= term; break;
+            case 3: sin -= term; break;
+        }
+        term *= angle / (k + 1);
+    }
+    return {sin, cos};
+}
+
+// Вершины правильного N-угольника для side_length = 1: (cos(2*pi*i/N), sin(2*pi*i/N)).
+// Фигуры получают свои вершины умножением таблицы на длину стороны
+template <size_t N>
+constexpr std::array<std::pair<double, double>, N> unitPolygon() {
+    std::array<std::pair<double, double>, N> result{};
+    for (size_t i = 0; i < N; ++i) {
+        auto [sin, cos] = constexprSinCos(2 * M_PI * i / N);
+        result[i] = {cos, sin};
+    }
+    return result;
+}
+
+// Центр вершин таблицы (среднее арифметическое)
+template <size_t N>
+constexpr std::pair<double, double> unitPolygonCenter(const std::array<std::pair<double, double>, N>& unit) {
+    double x_sum = 0, y_sum = 0;
+    for (const auto& vertex : unit) {
+        x_sum += vertex.first;
+        y_sum += vertex.second;
+    }
+    return {x_sum / N, y_sum / N};
+}
+
 class Figure {
-protected:
-    std::vector<std::pair<double, double>> vertices;
-    
 public:
     virtual ~Figure() = default;
     
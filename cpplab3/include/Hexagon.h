@@ -3,7 +3,7 @@
 
 #include "Figure.h"
 
-class Hexagon : public Figure {
+class Hexagon final : public Figure {
 public:
     Hexagon();
     explicit Hexagon(double side);
@@ -25,9 +25,18 @@ public:
     
     double getSide() const { return side_length; }
     
+    // Площадь = kAreaFactor * side_length^2 (sqrt(3) = 1.73205...)
+    static constexpr double kAreaFactor = 3.0 * 1.7320508075688772935 / 2.0;
+    
 private:
+    static constexpr auto kUnitVertices = unitPolygon<6>();
+    static constexpr auto kUnitCenter = unitPolygonCenter(kUnitVertices);
+
+    std::array<std::pair<double, double>, 6> vertices;
     double side_length;
-    void calculateVertices();
+    double cached_area;                      // Площадь и центр пересчитываются
+    std::pair<double, double> cached_center; // вместе с вершинами
+    void calculateVertices();                // Вершины, площадь и центр по side_length
 };
 
 #endif
\ No newline at end of file
@@ -3,7 +3,7 @@
 
 #include "Figure.h"
 
-class Octagon : public Figure {
+class Octagon final : public Figure {
 public:
     Octagon();
     explicit Octagon(double side);
@@ -25,9 +25,18 @@ public:
     
     double getSide() const { return side_length; }
     
+    // Площадь = kAreaFactor * side_length^2 (sqrt(2) = 1.41421...)
+    static constexpr double kAreaFactor = 2.0 * (1.0 + 1.4142135623730950488);
+    
 private:
+    static constexpr auto kUnitVertices = unitPolygon<8>();
+    static constexpr auto kUnitCenter = unitPolygonCenter(kUnitVertices);
+
+    std::array<std::pair<double, double>, 8> vertices;
     double side_length;
-    void calculateVertices();
+    double cached_area;                      // Площадь и центр пересчитываются
+    std::pair<double, double> cached_center; // вместе с вершинами
+    void calculateVertices();                // Вершины, площадь и центр по side_length
 };
 
 #endif
\ No newline at end of file
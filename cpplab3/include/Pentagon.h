@@ -3,7 +3,7 @@
 
 #include "Figure.h"
 
-class Pentagon : public Figure {
+class Pentagon final : public Figure {
 public:
     Pentagon();
     explicit Pentagon(double side);
@@ -26,9 +26,18 @@ public:
     
     double getSide() const { return side_length; }
     
+    // Площадь = kAreaFactor * side_length^2 (tan(pi / 5) = 0.72654...)
+    static constexpr double kAreaFactor = 5.0 / (4.0 * 0.72654252800536088590);
+    
 private:
+    static constexpr auto kUnitVertices = unitPolygon<5>();
+    static constexpr auto kUnitCenter = unitPolygonCenter(kUnitVertices);
+
+    std::array<std::pair<double, double>, 5> vertices;
     double side_length;
-    void calculateVertices();
+    double cached_area;                      // Площадь и центр пересчитываются
+    std::pair<double, double> cached_center; // вместе с вершинами
+    void calculateVertices();                // Вершины, площадь и центр по side_length
 };
 
 #endif
\ No newline at end of file
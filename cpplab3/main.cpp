@@ -34,8 +34,7 @@ int main() {
                     double side;
                     std::cin >> side;
                     
-                    auto pentagon = std::make_shared<Pentagon>(side);
-                    figuresArray.addFigure(pentagon);
+                    figuresArray.addFigure(Pentagon(side));
                     std::cout << "Pentagon added successfully!\n";
                     break;
                 }
@@ -45,8 +44,7 @@ int main() {
                     double side;
                     std::cin >> side;
                     
-                    auto hexagon = std::make_shared<Hexagon>(side);
-                    figuresArray.addFigure(hexagon);
+                    figuresArray.addFigure(Hexagon(side));
                     std::cout << "Hexagon added successfully!\n";
                     break;
                 }
@@ -56,8 +54,7 @@ int main() {
                     double side;
                     std::cin >> side;
                     
-                    auto octagon = std::make_shared<Octagon>(side);
-                    figuresArray.addFigure(octagon);
+                    figuresArray.addFigure(Octagon(side));
                     std::cout << "Octagon added successfully!\n";
                     break;
                 }
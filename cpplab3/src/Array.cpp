@@ -1,51 +1,348 @@
 #include "../include/Array.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <iomanip>
+#include <stdexcept>
+#include <thread>
 
-void Array::addFigure(std::shared_ptr<Figure> figure) {
-    figures.push_back(figure);
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Сумма квадратов count значений: несколько независимых векторных сумм (чтобы сложения
+// шли параллельно), остаток - скалярно
+double sumSquaresKernel(const double* values, size_t count) {
+    size_t i = 0;
+    double total = 0.0;
+#if defined(__AVX2__)
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    for (; i + 8 <= count; i += 8) {
+        __m256d a = _mm256_loadu_pd(values + i);
+        __m256d b = _mm256_loadu_pd(values + i + 4);
+        sum0 = _mm256_add_pd(sum0, _mm256_mul_pd(a, a));
+        sum1 = _mm256_add_pd(sum1, _mm256_mul_pd(b, b));
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, _mm256_add_pd(sum0, sum1));
+    total = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(__SSE2__) || defined(_M_X64)
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+    for (; i + 4 <= count; i += 4) {
+        __m128d a = _mm_loadu_pd(values + i);
+        __m128d b = _mm_loadu_pd(values + i + 2);
+        sum0 = _mm_add_pd(sum0, _mm_mul_pd(a, a));
+        sum1 = _mm_add_pd(sum1, _mm_mul_pd(b, b));
+    }
+    alignas(16) double lanes[2];
+    _mm_store_pd(lanes, _mm_add_pd(sum0, sum1));
+    total = lanes[0] + lanes[1];
+#endif
+    for (; i < count; ++i) {
+        total += values[i] * values[i];
+    }
+    return total;
+}
+
+// Место ещё под один элемент (с удвоением ёмкости, как у push_back)
+template <class V>
+void reserveOneMore(V& values) {
+    if (values.size() == values.capacity()) {
+        values.reserve(std::max<size_t>(8, values.capacity() * 2));
+    }
+}
+
+} // namespace
+
+Array::Handle Array::addFigure(std::shared_ptr<Figure> figure) {
+    if (const auto* pentagon = dynamic_cast<const Pentagon*>(figure.get())) {
+        return addFigure(*pentagon);
+    } else if (const auto* hexagon = dynamic_cast<const Hexagon*>(figure.get())) {
+        return addFigure(*hexagon);
+    } else if (const auto* octagon = dynamic_cast<const Octagon*>(figure.get())) {
+        return addFigure(*octagon);
+    }
+    throw std::invalid_argument("Unsupported figure type");
+}
+
+Array::Handle Array::addFigure(Pentagon figure) {
+    return insert(pentagons, FigureType::Pentagon, std::move(figure));
+}
+
+Array::Handle Array::addFigure(Hexagon figure) {
+    return insert(hexagons, FigureType::Hexagon, std::move(figure));
+}
+
+Array::Handle Array::addFigure(Octagon figure) {
+    return insert(octagons, FigureType::Octagon, std::move(figure));
+}
+
+// Слот берётся из списка свободных (со старым увеличенным поколением) или добавляется новый.
+// Память во всех векторах выделяется до изменения массива: если выделение бросает исключение,
+// массив остаётся прежним, а добавления после него уже не перераспределяют память
+template <class T>
+Array::Handle Array::insert(TypeStorage<T>& storage, FigureType type, T&& figure) {
+    bool newSlot = freeSlot == kNoSlot;
+    if (newSlot && slots.size() >= kNoSlot) {
+        throw std::length_error("Too many figures");
+    }
+    reserveOneMore(storage.figures);
+    reserveOneMore(storage.sides);
+    reserveOneMore(storage.slots);
+    reserveOneMore(order);
+    if (newSlot) {
+        reserveOneMore(slots);
+    }
+
+    uint32_t id = newSlot ? static_cast<uint32_t>(slots.size()) : freeSlot;
+    double area = figure.area();
+    storage.figures.push_back(std::move(figure));
+    storage.sides.push_back(storage.figures.back().getSide());
+    storage.slots.push_back(id);
+    if (newSlot) {
+        slots.emplace_back();
+    } else {
+        freeSlot = static_cast<uint32_t>(slots[id].index);
+    }
+
+    Slot& slot = slots[id];
+    slot.type = type;
+    slot.index = storage.figures.size() - 1;
+    slot.position = order.size();
+    order.push_back(id);
+    accumulateArea(area);
+    return {id, slot.generation};
 }
 
 void Array::removeFigure(size_t index) {
-    if (index < figures.size()) {
-        figures.erase(figures.begin() + index);
+    if (index >= order.size()) {
+        return;
+    }
+    uint32_t id = order[index];
+    order.erase(order.begin() + index);
+    for (size_t i = index; i < order.size(); ++i) {
+        slots[order[i]].position = i;
+    }
+    releaseSlot(id);
+}
+
+void Array::removeFigureUnordered(size_t index) {
+    if (index >= order.size()) {
+        return;
+    }
+    uint32_t id = order[index];
+    order[index] = order.back();
+    slots[order[index]].position = index;
+    order.pop_back();
+    releaseSlot(id);
+}
+
+bool Array::removeFigure(Handle handle) {
+    if (!contains(handle)) {
+        return false;
+    }
+    removeFigureUnordered(slots[handle.slot].position);
+    return true;
+}
+
+void Array::releaseSlot(uint32_t id) {
+    Slot& slot = slots[id];
+    accumulateArea(-figureAt(id).area());
+    switch (slot.type) {
+        case FigureType::Pentagon: eraseFrom(pentagons, slot.index); break;
+        case FigureType::Hexagon: eraseFrom(hexagons, slot.index); break;
+        case FigureType::Octagon: eraseFrom(octagons, slot.index); break;
+    }
+    ++slot.generation;
+    slot.index = freeSlot;
+    freeSlot = id;
+    if (order.empty()) {
+        areaSum = 0.0;
+        areaCompensation = 0.0;
+    }
+}
+
+template <class T>
+void Array::eraseFrom(TypeStorage<T>& storage, size_t index) {
+    size_t last = storage.figures.size() - 1;
+    if (index != last) {
+        storage.figures[index] = std::move(storage.figures[last]);
+        storage.sides[index] = storage.sides[last];
+        storage.slots[index] = storage.slots[last];
+        slots[storage.slots[index]].index = index;
     }
+    storage.figures.pop_back();
+    storage.sides.pop_back();
+    storage.slots.pop_back();
 }
 
 double Array::totalArea() const {
+    return areaSum + areaCompensation;
+}
+
+double Array::computeTotalArea(Execution execution) const {
+    return Pentagon::kAreaFactor * sumSquares(pentagons.sides, execution) +
+           Hexagon::kAreaFactor * sumSquares(hexagons.sides, execution) +
+           Octagon::kAreaFactor * sumSquares(octagons.sides, execution);
+}
+
+double Array::sumSquares(std::span<const double> values, Execution execution) {
+    // Минимальное число значений на поток: меньшие части не окупают запуск потока
+    constexpr size_t kValuesPerThread = 1 << 16;
+
+    // hardware_concurrency() - системный вызов, поэтому он делается только для больших массивов
+    size_t threads = 1;
+    if (execution == Execution::Parallel && values.size() >= 2 * kValuesPerThread) {
+        threads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                   values.size() / kValuesPerThread);
+    }
+    return sumSquares(values, threads);
+}
+
+double Array::sumSquares(std::span<const double> values, size_t threads) {
+    threads = std::min(threads, values.size());
+    if (threads <= 1) {
+        return sumSquaresKernel(values.data(), values.size());
+    }
+
+    std::vector<double> partial(threads);
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(threads - 1);
+        size_t chunk = values.size() / threads;
+        size_t remainder = values.size() % threads;
+        const double* begin = values.data();
+        for (size_t t = 0; t < threads; ++t) {
+            size_t count = chunk + (t < remainder ? 1 : 0);
+            if (t + 1 == threads) {
+                partial[t] = sumSquaresKernel(begin, count); // Последняя часть - в вызывающем потоке
+            } else {
+                workers.emplace_back([&partial, t, begin, count] {
+                    partial[t] = sumSquaresKernel(begin, count);
+                });
+            }
+            begin += count;
+        }
+    }
     double total = 0.0;
-    for (const auto& figure : figures) {
-        total += figure->area();
+    for (double value : partial) {
+        total += value;
     }
     return total;
 }
 
+// Шаг суммирования Ноймайера: потерянные младшие разряды слагаемого копятся в компенсации
+void Array::accumulateArea(double area) {
+    double sum = areaSum + area;
+    if (std::abs(areaSum) >= std::abs(area)) {
+        areaCompensation += (areaSum - sum) + area;
+    } else {
+        areaCompensation += (area - sum) + areaSum;
+    }
+    areaSum = sum;
+}
+
 void Array::printAll() const {
     std::cout << std::fixed << std::setprecision(3);
-    
-    for (size_t i = 0; i < figures.size(); ++i) {
+
+    for (size_t i = 0; i < order.size(); ++i) {
+        const Figure& figure = figureAt(order[i]);
         std::cout << "Figure #" << i + 1 << ":\n";
-        std::cout << "  Vertices: " << *figures[i] << "\n";
-        
-        auto center = figures[i]->center();
+        std::cout << "  Vertices: " << figure << "\n";
+
+        auto center = figure.center();
         std::cout << "  Center: (" << center.first << ", " << center.second << ")\n";
-        
-        std::cout << "  Area: " << figures[i]->area() << "\n";
+
+        std::cout << "  Area: " << figure.area() << "\n";
         std::cout << std::string(30, '-') << "\n";
     }
 }
 
 size_t Array::size() const {
-    return figures.size();
+    return order.size();
 }
 
 std::shared_ptr<Figure> Array::getFigure(size_t index) const {
-    if (index < figures.size()) {
-        return figures[index];
+    if (index >= order.size()) {
+        return nullptr;
+    }
+    const Slot& slot = slots[order[index]];
+    switch (slot.type) {
+        case FigureType::Pentagon: return std::make_shared<Pentagon>(pentagons.figures[slot.index]);
+        case FigureType::Hexagon: return std::make_shared<Hexagon>(hexagons.figures[slot.index]);
+        case FigureType::Octagon: return std::make_shared<Octagon>(octagons.figures[slot.index]);
     }
     return nullptr;
 }
 
+const Figure& Array::operator[](size_t index) const {
+    if (index >= order.size()) {
+        throw std::out_of_range("Figure index out of range");
+    }
+    return figureAt(order[index]);
+}
+
+Array::FigureType Array::getType(size_t index) const {
+    if (index >= order.size()) {
+        throw std::out_of_range("Figure index out of range");
+    }
+    return slots[order[index]].type;
+}
+
+// Идентификатор действителен, если поколение слота не менялось с момента выдачи
+bool Array::contains(Handle handle) const {
+    return handle.slot < slots.size() && slots[handle.slot].generation == handle.generation &&
+           slots[handle.slot].position < order.size() && order[slots[handle.slot].position] == handle.slot;
+}
+
+size_t Array::positionOf(Handle handle) const {
+    if (!contains(handle)) {
+        throw std::out_of_range("Invalid figure handle");
+    }
+    return slots[handle.slot].position;
+}
+
+const Figure& Array::operator[](Handle handle) const {
+    return figureAt(order[positionOf(handle)]);
+}
+
+size_t Array::getIndex(Handle handle) const {
+    return positionOf(handle);
+}
+
+Array::Handle Array::getHandle(size_t index) const {
+    if (index >= order.size()) {
+        throw std::out_of_range("Figure index out of range");
+    }
+    return {order[index], slots[order[index]].generation};
+}
+
+const Figure& Array::figureAt(uint32_t id) const {
+    const Slot& slot = slots[id];
+    switch (slot.type) {
+        case FigureType::Pentagon: return pentagons.figures[slot.index];
+        case FigureType::Hexagon: return hexagons.figures[slot.index];
+        case FigureType::Octagon: break;
+    }
+    return octagons.figures[slot.index];
+}
+
+// Слоты остаются (с новым поколением) в списке свободных, чтобы старые идентификаторы
+// не стали снова действительными
 void Array::clear() {
-    figures.clear();
+    for (uint32_t id : order) {
+        ++slots[id].generation;
+        slots[id].index = freeSlot;
+        freeSlot = id;
+    }
+    pentagons = {};
+    hexagons = {};
+    octagons = {};
+    order.clear();
+    areaSum = 0.0;
+    areaCompensation = 0.0;
 }
\ No newline at end of file
@@ -13,22 +13,22 @@ Hexagon::Hexagon(double side) : side_length(side) {
     calculateVertices();
 }
 
-Hexagon::Hexagon(const Hexagon& other) : side_length(other.side_length) {
+Hexagon::Hexagon(const Hexagon& other)
+    : side_length(other.side_length), cached_area(other.cached_area), cached_center(other.cached_center) {
     vertices = other.vertices;
 }
 
-Hexagon::Hexagon(Hexagon&& other) noexcept : side_length(other.side_length) {
+Hexagon::Hexagon(Hexagon&& other) noexcept
+    : side_length(other.side_length), cached_area(other.cached_area), cached_center(other.cached_center) {
     vertices = std::move(other.vertices);
     other.side_length = 0;
+    other.cached_area = 0;
+    other.cached_center = {0, 0};
+    other.vertices = {};
 }
 
 std::pair<double, double> Hexagon::center() const {
-    double x_sum = 0, y_sum = 0;
-    for (const auto& vertex : vertices) {
-        x_sum += vertex.first;
-        y_sum += vertex.second;
-    }
-    return {x_sum / 6.0, y_sum / 6.0};
+    return cached_center;
 }
 
 void Hexagon::print(std::ostream& os) const {
@@ -54,7 +54,7 @@ Hexagon::operator double() const {
 }
 
 double Hexagon::area() const {
-    return (3.0 * std::sqrt(3.0) * side_length * side_length) / 2.0;
+    return cached_area;
 }
 
 bool Hexagon::operator==(const Figure& other) const {
@@ -66,6 +66,8 @@ bool Hexagon::operator==(const Figure& other) const {
 Hexagon& Hexagon::operator=(const Hexagon& other) {
     if (this != &other) {
         side_length = other.side_length;
+        cached_area = other.cached_area;
+        cached_center = other.cached_center;
         vertices = other.vertices;
     }
     return *this;
@@ -75,6 +77,8 @@ Figure& Hexagon::operator=(const Figure& other) {
     const Hexagon* hexagon = dynamic_cast<const Hexagon*>(&other);
     if (hexagon) {
         side_length = hexagon->side_length;
+        cached_area = hexagon->cached_area;
+        cached_center = hexagon->cached_center;
         vertices = hexagon->vertices;
     }
     return *this;
@@ -83,18 +87,22 @@ Figure& Hexagon::operator=(const Figure& other) {
 Hexagon& Hexagon::operator=(Hexagon&& other) noexcept {
     if (this != &other) {
         side_length = other.side_length;
+        cached_area = other.cached_area;
+        cached_center = other.cached_center;
         vertices = std::move(other.vertices);
         other.side_length = 0;
+        other.cached_area = 0;
+        other.cached_center = {0, 0};
+        other.vertices = {};
     }
     return *this;
 }
 
+// Вершины и центр - таблица единичного многоугольника, умноженная на длину стороны
 void Hexagon::calculateVertices() {
-    vertices.clear();
-    for (int i = 0; i < 6; ++i) {
-        double angle = 2 * M_PI * i / 6;
-        double x = side_length * std::cos(angle);
-        double y = side_length * std::sin(angle);
-        vertices.emplace_back(x, y);
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        vertices[i] = {side_length * kUnitVertices[i].first, side_length * kUnitVertices[i].second};
     }
+    cached_area = kAreaFactor * side_length * side_length;
+    cached_center = {side_length * kUnitCenter.first, side_length * kUnitCenter.second};
 }
\ No newline at end of file
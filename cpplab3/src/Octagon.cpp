@@ -13,22 +13,22 @@ Octagon::Octagon(double side) : side_length(side) {
     calculateVertices();
 }
 
-Octagon::Octagon(const Octagon& other) : side_length(other.side_length) {
+Octagon::Octagon(const Octagon& other)
+    : side_length(other.side_length), cached_area(other.cached_area), cached_center(other.cached_center) {
     vertices = other.vertices;
 }
 
-Octagon::Octagon(Octagon&& other) noexcept : side_length(other.side_length) {
+Octagon::Octagon(Octagon&& other) noexcept
+    : side_length(other.side_length), cached_area(other.cached_area), cached_center(other.cached_center) {
     vertices = std::move(other.vertices);
     other.side_length = 0;
+    other.cached_area = 0;
+    other.cached_center = {0, 0};
+    other.vertices = {};
 }
 
 std::pair<double, double> Octagon::center() const {
-    double x_sum = 0, y_sum = 0;
-    for (const auto& vertex : vertices) {
-        x_sum += vertex.first;
-        y_sum += vertex.second;
-    }
-    return {x_sum / 8.0, y_sum / 8.0};
+    return cached_center;
 }
 
 void Octagon::print(std::ostream& os) const {
@@ -54,7 +54,7 @@ Octagon::operator double() const {
 }
 
 double Octagon::area() const {
-    return 2.0 * (1.0 + std::sqrt(2.0)) * side_length * side_length;
+    return cached_area;
 }
 
 bool Octagon::operator==(const Figure& other) const {
@@ -66,6 +66,8 @@ bool Octagon::operator==(const Figure& other) const {
 Octagon& Octagon::operator=(const Octagon& other) {
     if (this != &other) {
         side_length = other.side_length;
+        cached_area = other.cached_area;
+        cached_center = other.cached_center;
         vertices = other.vertices;
     }
     return *this;
@@ -75,6 +77,8 @@ Figure& Octagon::operator=(const Figure& other) {
     const Octagon* octagon = dynamic_cast<const Octagon*>(&other);
     if (octagon) {
         side_length = octagon->side_length;
+        cached_area = octagon->cached_area;
+        cached_center = octagon->cached_center;
         vertices = octagon->vertices;
     }
     return *this;
@@ -83,18 +87,22 @@ Figure& Octagon::operator=(const Figure& other) {
 Octagon& Octagon::operator=(Octagon&& other) noexcept {
     if (this != &other) {
         side_length = other.side_length;
+        cached_area = other.cached_area;
+        cached_center = other.cached_center;
         vertices = std::move(other.vertices);
         other.side_length = 0;
+        other.cached_area = 0;
+        other.cached_center = {0, 0};
+        other.vertices = {};
     }
     return *this;
 }
 
+// Вершины и центр - таблица единичного многоугольника, умноженная на длину стороны
 void Octagon::calculateVertices() {
-    vertices.clear();
-    for (int i = 0; i < 8; ++i) {
-        double angle = 2 * M_PI * i / 8;
-        double x = side_length * std::cos(angle);
-        double y = side_length * std::sin(angle);
-        vertices.emplace_back(x, y);
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        vertices[i] = {side_length * kUnitVertices[i].first, side_length * kUnitVertices[i].second};
     }
+    cached_area = kAreaFactor * side_length * side_length;
+    cached_center = {side_length * kUnitCenter.first, side_length * kUnitCenter.second};
 }
\ No newline at end of file
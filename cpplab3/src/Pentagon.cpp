@@ -13,22 +13,22 @@ Pentagon::Pentagon(double side) : side_length(side) {
     calculateVertices();
 }
 
-Pentagon::Pentagon(const Pentagon& other) : side_length(other.side_length) {
+Pentagon::Pentagon(const Pentagon& other)
+    : side_length(other.side_length), cached_area(other.cached_area), cached_center(other.cached_center) {
     vertices = other.vertices;
 }
 
-Pentagon::Pentagon(Pentagon&& other) noexcept : side_length(other.side_length) {
+Pentagon::Pentagon(Pentagon&& other) noexcept
+    : side_length(other.side_length), cached_area(other.cached_area), cached_center(other.cached_center) {
     vertices = std::move(other.vertices);
     other.side_length = 0;
+    other.cached_area = 0;
+    other.cached_center = {0, 0};
+    other.vertices = {};
 }
 
 std::pair<double, double> Pentagon::center() const {
-    double x_sum = 0, y_sum = 0;
-    for (const auto& vertex : vertices) {
-        x_sum += vertex.first;
-        y_sum += vertex.second;
-    }
-    return {x_sum / 5.0, y_sum / 5.0};
+    return cached_center;
 }
 
 void Pentagon::print(std::ostream& os) const {
@@ -54,7 +54,7 @@ Pentagon::operator double() const {
 }
 
 double Pentagon::area() const {
-    return (5.0 * side_length * side_length) / (4.0 * std::tan(M_PI / 5.0));
+    return cached_area;
 }
 
 bool Pentagon::operator==(const Figure& other) const {
@@ -66,6 +66,8 @@ bool Pentagon::operator==(const Figure& other) const {
 Pentagon& Pentagon::operator=(const Pentagon& other) {
     if (this != &other) {
         side_length = other.side_length;
+        cached_area = other.cached_area;
+        cached_center = other.cached_center;
         vertices = other.vertices;
     }
     return *this;
@@ -75,6 +77,8 @@ Figure& Pentagon::operator=(const Figure& other) {
     const Pentagon* pentagon = dynamic_cast<const Pentagon*>(&other);
     if (pentagon) {
         side_length = pentagon->side_length;
+        cached_area = pentagon->cached_area;
+        cached_center = pentagon->cached_center;
         vertices = pentagon->vertices;
     }
     return *this;
@@ -83,18 +87,22 @@ Figure& Pentagon::operator=(const Figure& other) {
 Pentagon& Pentagon::operator=(Pentagon&& other) noexcept {
     if (this != &other) {
         side_length = other.side_length;
+        cached_area = other.cached_area;
+        cached_center = other.cached_center;
         vertices = std::move(other.vertices);
         other.side_length = 0;
+        other.cached_area = 0;
+        other.cached_center = {0, 0};
+        other.vertices = {};
     }
     return *this;
 }
 
+// Вершины и центр - таблица единичного многоугольника, умноженная на длину стороны
 void Pentagon::calculateVertices() {
-    vertices.clear();
-    for (int i = 0; i < 5; ++i) {
-        double angle = 2 * M_PI * i / 5;
-        double x = side_length * std::cos(angle);
-        double y = side_length * std::sin(angle);
-        vertices.emplace_back(x, y);
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        vertices[i] = {side_length * kUnitVertices[i].first, side_length * kUnitVertices[i].second};
     }
+    cached_area = kAreaFactor * side_length * side_length;
+    cached_center = {side_length * kUnitCenter.first, side_length * kUnitCenter.second};
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "../include/Array.h"
+
+// Массив из count фигур: типы по очереди, длины сторон от 1 до 2
+static Array makeArray(size_t count) {
+    Array array;
+    for (size_t i = 0; i < count; ++i) {
+        double side = 1.0 + static_cast<double>(i % 1000) / 1000.0;
+        switch (i % 3) {
+            case 0: array.addFigure(Pentagon(side)); break;
+            case 1: array.addFigure(Hexagon(side)); break;
+            default: array.addFigure(Octagon(side)); break;
+        }
+    }
+    return array;
+}
+
+static void setFiguresProcessed(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Площадь, поддерживаемая при добавлении и удалении (без обхода)
+static void BM_TotalAreaRunning(benchmark::State& state) {
+    const Array array = makeArray(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(array.totalArea());
+    }
+}
+BENCHMARK(BM_TotalAreaRunning)->Arg(10000)->Arg(1000000);
+
+// Обход в порядке добавления через виртуальный area() - как до хранения по типам
+static void BM_TotalAreaVirtual(benchmark::State& state) {
+    const Array array = makeArray(state.range(0));
+    for (auto _ : state) {
+        double total = 0.0;
+        for (size_t i = 0; i < array.size(); ++i) {
+            total += array[i].area();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    setFiguresProcessed(state);
+}
+BENCHMARK(BM_TotalAreaVirtual)->Arg(10000)->Arg(1000000);
+
+// Пересчёт по массивам сторон: в одном потоке и с разбиением между потоками
+template <Array::Execution execution>
+static void BM_ComputeTotalArea(benchmark::State& state) {
+    const Array array = makeArray(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(array.computeTotalArea(execution));
+    }
+    setFiguresProcessed(state);
+}
+BENCHMARK(BM_ComputeTotalArea<Array::Execution::Sequential>)->Arg(10000)->Arg(1000000);
+BENCHMARK(BM_ComputeTotalArea<Array::Execution::Parallel>)->Arg(10000)->Arg(1000000)->UseRealTime();
+
+// Только ядро по массиву сторон: 100M фигур целиком (около 12 ГБ) не помещаются в память,
+// а массив сторон занимает 800 МБ
+template <Array::Execution execution>
+static void BM_SumSquares(benchmark::State& state) {
+    std::vector<double> sides(state.range(0));
+    for (size_t i = 0; i < sides.size(); ++i) {
+        sides[i] = 1.0 + static_cast<double>(i % 1000) / 1000.0;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Array::sumSquares(sides, execution));
+    }
+    setFiguresProcessed(state);
+}
+BENCHMARK(BM_SumSquares<Array::Execution::Sequential>)
+    ->Arg(10000)->Arg(1000000)->Arg(100000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SumSquares<Array::Execution::Parallel>)
+    ->Arg(10000)->Arg(1000000)->Arg(100000000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+// Удаление и добавление фигуры при постоянном размере массива: со сдвигом (порядок сохраняется),
+// переносом последней фигуры и по идентификатору
+static void BM_RemoveOrdered(benchmark::State& state) {
+    Array array = makeArray(state.range(0));
+    size_t index = 0;
+    for (auto _ : state) {
+        index = (index + 7919) % array.size();
+        array.removeFigure(index);
+        array.addFigure(Hexagon(1.5));
+    }
+}
+BENCHMARK(BM_RemoveOrdered)->Arg(10000)->Arg(1000000);
+
+static void BM_RemoveUnordered(benchmark::State& state) {
+    Array array = makeArray(state.range(0));
+    size_t index = 0;
+    for (auto _ : state) {
+        index = (index + 7919) % array.size();
+        array.removeFigureUnordered(index);
+        array.addFigure(Hexagon(1.5));
+    }
+}
+BENCHMARK(BM_RemoveUnordered)->Arg(10000)->Arg(1000000);
+
+static void BM_RemoveByHandle(benchmark::State& state) {
+    Array array = makeArray(state.range(0));
+    std::vector<Array::Handle> handles;
+    for (size_t i = 0; i < array.size(); ++i) {
+        handles.push_back(array.getHandle(i));
+    }
+    size_t index = 0;
+    for (auto _ : state) {
+        index = (index + 7919) % handles.size();
+        array.removeFigure(handles[index]);
+        handles[index] = array.addFigure(Hexagon(1.5));
+    }
+}
+BENCHMARK(BM_RemoveByHandle)->Arg(10000)->Arg(1000000);
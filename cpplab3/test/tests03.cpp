@@ -3,6 +3,8 @@
 #include "../include/Hexagon.h"
 #include "../include/Octagon.h"
 #include "../include/Array.h"
+#include <cstdio>
+#include <iomanip>
 
 TEST(PentagonTest, AreaCalculation) {
     Pentagon p(5.0);
@@ -123,6 +125,241 @@ TEST(FigureTest, DifferentTypesNotEqual) {
     EXPECT_FALSE(p.operator==(h));
 }
 
+TEST(ArrayTest, OrderPreservedAcrossTypes) {
+    Array array;
+    array.addFigure(Pentagon(1.0));
+    array.addFigure(Hexagon(2.0));
+    array.addFigure(Pentagon(3.0));
+    array.addFigure(std::make_shared<Octagon>(4.0));
+    array.addFigure(Hexagon(5.0));
+
+    EXPECT_EQ(array.getPentagons().size(), 2);
+    EXPECT_EQ(array.getHexagons().size(), 2);
+    EXPECT_EQ(array.getOctagons().size(), 1);
+
+    // Удаление из середины: порядок остальных фигур сохраняется
+    array.removeFigure(0);
+    array.removeFigure(1);
+    ASSERT_EQ(array.size(), 3);
+    EXPECT_EQ(array.getType(0), Array::FigureType::Hexagon);
+    EXPECT_EQ(array.getType(1), Array::FigureType::Octagon);
+    EXPECT_EQ(array.getType(2), Array::FigureType::Hexagon);
+    EXPECT_TRUE(array[0] == Hexagon(2.0));
+    EXPECT_TRUE(array[1] == Octagon(4.0));
+    EXPECT_TRUE(array[2] == Hexagon(5.0));
+    EXPECT_THROW(array[3], std::out_of_range);
+
+    double expected = Hexagon(2.0).area() + Octagon(4.0).area() + Hexagon(5.0).area();
+    EXPECT_NEAR(array.totalArea(), expected, 1e-9);
+}
+
+TEST(ArrayTest, GetFigureReturnsCopy) {
+    Array array;
+    array.addFigure(Octagon(2.0));
+
+    auto copy = array.getFigure(0);
+    std::stringstream ss("7");
+    ss >> *copy;
+    EXPECT_TRUE(array[0] == Octagon(2.0));
+
+    EXPECT_THROW(array.addFigure(std::shared_ptr<Figure>()), std::invalid_argument);
+    EXPECT_EQ(array.size(), 1);
+}
+
+TEST(FigureTest, CachedAreaAndCenter) {
+    Hexagon h(2.0);
+    h = Hexagon(3.0);
+    EXPECT_NEAR(h.area(), (3.0 * std::sqrt(3.0) * 9.0) / 2.0, 1e-9);
+
+    std::stringstream ss("4");
+    ss >> h;
+    EXPECT_NEAR(h.area(), (3.0 * std::sqrt(3.0) * 16.0) / 2.0, 1e-9);
+    EXPECT_NEAR(h.center().first, 0.0, 1e-9);
+
+    Octagon o1(2.0), o2(5.0);
+    Figure& base = o1;
+    base = o2;
+    EXPECT_NEAR(o1.area(), o2.area(), 1e-12);
+}
+
+TEST(FigureTest, MovedFromIsEmpty) {
+    // У перемещённой фигуры (конструктором и присваиванием) сброшены площадь, центр и вершины
+    auto check = [](auto figure, const std::string& name, size_t vertexCount) {
+        std::string empty = name + " vertices:";
+        for (size_t i = 0; i < vertexCount; ++i) {
+            empty += " (0, 0)";
+        }
+        auto text = [](const Figure& f) {
+            std::stringstream ss;
+            ss << f;
+            return ss.str();
+        };
+        std::string original = text(figure);
+        double area = figure.area();
+
+        auto moved(std::move(figure));
+        EXPECT_EQ(text(moved), original);
+        EXPECT_EQ(text(figure), empty);
+        EXPECT_EQ(figure.area(), 0.0);
+        EXPECT_EQ(figure.center(), std::make_pair(0.0, 0.0));
+
+        figure = std::move(moved);
+        EXPECT_EQ(text(figure), original);
+        EXPECT_EQ(figure.area(), area);
+        EXPECT_EQ(text(moved), empty);
+        EXPECT_EQ(moved.area(), 0.0);
+        EXPECT_EQ(moved.center(), std::make_pair(0.0, 0.0));
+    };
+    check(Pentagon(2.0), "Pentagon", 5);
+    check(Hexagon(3.0), "Hexagon", 6);
+    check(Octagon(1.5), "Octagon", 8);
+}
+
+TEST(ArrayTest, RunningTotalArea) {
+    Array array;
+    double expected = 0.0;
+    for (int i = 1; i <= 1000; ++i) {
+        array.addFigure(Pentagon(i * 0.5));
+    }
+    for (int i = 1; i <= 1000; ++i) {
+        array.addFigure(Octagon(1.0 / i));
+    }
+    // Удаляются все пятиугольники, кроме последнего
+    for (int i = 0; i < 999; ++i) {
+        array.removeFigure(0);
+    }
+    for (size_t i = 0; i < array.size(); ++i) {
+        expected += array[i].area();
+    }
+    EXPECT_EQ(array.size(), 1001);
+    EXPECT_NEAR(array.totalArea(), expected, 1e-9 * expected);
+
+    while (array.size() > 0) {
+        array.removeFigure(array.size() - 1);
+    }
+    EXPECT_EQ(array.totalArea(), 0.0);
+}
+
+// Вершины из вывода operator<<: "Name vertices: (x, y) (x, y) ..."
+static std::vector<std::pair<double, double>> parseVertices(const Figure& figure) {
+    std::stringstream ss;
+    ss << std::setprecision(17) << figure;
+    std::string text = ss.str();
+    std::vector<std::pair<double, double>> result;
+    for (size_t pos = text.find('('); pos != std::string::npos; pos = text.find('(', pos + 1)) {
+        double x = 0, y = 0;
+        std::sscanf(text.c_str() + pos, "(%lf, %lf)", &x, &y);
+        result.emplace_back(x, y);
+    }
+    return result;
+}
+
+TEST(FigureTest, VertexTablesMatchTrigonometry) {
+    const double side = 2.5;
+    Pentagon p(side);
+    Hexagon h(side);
+    Octagon o(side);
+    const Figure* figures[] = {&p, &h, &o};
+    const int counts[] = {5, 6, 8};
+    for (int f = 0; f < 3; ++f) {
+        auto vertices = parseVertices(*figures[f]);
+        ASSERT_EQ(vertices.size(), counts[f]);
+        for (int i = 0; i < counts[f]; ++i) {
+            double angle = 2 * M_PI * i / counts[f];
+            EXPECT_NEAR(vertices[i].first, side * std::cos(angle), 1e-12);
+            EXPECT_NEAR(vertices[i].second, side * std::sin(angle), 1e-12);
+        }
+        EXPECT_NEAR(figures[f]->center().first, 0.0, 1e-12);
+        EXPECT_NEAR(figures[f]->center().second, 0.0, 1e-12);
+    }
+    EXPECT_NEAR(p.area(), (5.0 * side * side) / (4.0 * std::tan(M_PI / 5.0)), 1e-12);
+}
+
+TEST(ArrayTest, ComputeTotalAreaModes) {
+    Array array;
+    for (int i = 0; i < 300000; ++i) {
+        double side = 1.0 + (i % 97) * 0.01;
+        switch (i % 3) {
+            case 0: array.addFigure(Pentagon(side)); break;
+            case 1: array.addFigure(Hexagon(side)); break;
+            default: array.addFigure(Octagon(side)); break;
+        }
+    }
+    for (int i = 0; i < 1000; ++i) {
+        array.removeFigure(i * 7);
+    }
+
+    double expected = array.totalArea();
+    EXPECT_NEAR(array.computeTotalArea(), expected, 1e-9 * expected);
+    EXPECT_NEAR(array.computeTotalArea(Array::Execution::Parallel), expected, 1e-9 * expected);
+
+    std::vector<double> values = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+    EXPECT_EQ(Array::sumSquares(values), 285.0);
+    EXPECT_EQ(Array::sumSquares({}), 0.0);
+
+    // Разбиение на заданное число частей (в том числе неравных и меньше одного вектора AVX2).
+    // Целые квадраты складываются без округления, поэтому суммы должны совпасть точно
+    std::vector<double> integers(100003);
+    for (size_t i = 0; i < integers.size(); ++i) {
+        integers[i] = static_cast<double>(i % 1000);
+    }
+    double sequential = Array::sumSquares(integers);
+    for (size_t threads : {2, 3, 7}) {
+        EXPECT_EQ(Array::sumSquares(integers, threads), sequential) << threads << " threads";
+    }
+    EXPECT_EQ(Array::sumSquares(values, 7), 285.0);
+    EXPECT_EQ(Array::sumSquares(values, 100), 285.0);
+}
+
+TEST(ArrayTest, HandlesStayValidAcrossRemoval) {
+    Array array;
+    Array::Handle p = array.addFigure(Pentagon(1.0));
+    Array::Handle h = array.addFigure(Hexagon(2.0));
+    Array::Handle o = array.addFigure(Octagon(3.0));
+
+    array.removeFigure(0);
+    EXPECT_FALSE(array.contains(p));
+    EXPECT_TRUE(array[h] == Hexagon(2.0));
+    EXPECT_EQ(array.getIndex(o), 1);
+    EXPECT_FALSE(array.removeFigure(p));
+    EXPECT_THROW(array[p], std::out_of_range);
+
+    // Освободившийся слот занимает новая фигура, старый идентификатор остаётся недействительным
+    Array::Handle q = array.addFigure(Pentagon(4.0));
+    EXPECT_EQ(q.slot, p.slot);
+    EXPECT_FALSE(array.contains(p));
+    EXPECT_TRUE(array[q] == Pentagon(4.0));
+    EXPECT_TRUE(array.getHandle(2) == q);
+
+    // Удаление по идентификатору: на место удалённой фигуры переносится последняя
+    EXPECT_TRUE(array.removeFigure(h));
+    EXPECT_EQ(array.size(), 2);
+    EXPECT_EQ(array.getIndex(q), 0);
+    EXPECT_EQ(array.getIndex(o), 1);
+    EXPECT_NEAR(array.totalArea(), Pentagon(4.0).area() + Octagon(3.0).area(), 1e-9);
+
+    array.clear();
+    EXPECT_FALSE(array.contains(q));
+    EXPECT_FALSE(array.contains(o));
+    EXPECT_FALSE(array.contains(Array::Handle{}));
+}
+
+TEST(ArrayTest, RemoveFigureUnordered) {
+    Array array;
+    for (int i = 1; i <= 5; ++i) {
+        array.addFigure(Hexagon(i));
+    }
+    array.removeFigureUnordered(1);
+    ASSERT_EQ(array.size(), 4);
+    EXPECT_TRUE(array[0] == Hexagon(1.0));
+    EXPECT_TRUE(array[1] == Hexagon(5.0));
+    EXPECT_TRUE(array[3] == Hexagon(4.0));
+    array.removeFigureUnordered(3);
+    array.removeFigureUnordered(10);
+    EXPECT_EQ(array.size(), 3);
+    EXPECT_EQ(array.getHexagons().size(), 3);
+}
+
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();